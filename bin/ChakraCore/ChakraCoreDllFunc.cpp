@@ -113,6 +113,7 @@ static void DetachProcess()
     // shutdown is bad because we shouldn't free objects built into
     // other dlls.
     JsrtRuntime::Uninitialize();
+    SharedSegmentPool::ReleaseAll();
 
     // thread-bound entrypoint should be able to get cleanup correctly, however tlsentry
     // for current thread might be left behind if this thread was initialized.
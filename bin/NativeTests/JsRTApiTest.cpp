@@ -985,6 +985,150 @@ namespace JsRTApiTest
         JsRTApiTest::RunWithAttributes(JsRTApiTest::ByteCodeTest);
     }
 
+    void ScriptProfileTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        LPCWSTR script = _u("function add(a, b) { return a + b; } var sum = 0; for (var i = 0; i < 100; i++) { sum = add(sum, i); } sum == 4950;");
+        const JsSourceContext sourceContext = 1;
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        bool boolValue;
+        REQUIRE(JsRunScript(script, sourceContext, _u(""), &result) == JsNoError);
+        REQUIRE(JsBooleanToBool(result, &boolValue) == JsNoError);
+        CHECK(boolValue);
+
+        JsValueRef profile = JS_INVALID_REFERENCE;
+        REQUIRE(JsSerializeScriptProfile(sourceContext, &profile) == JsNoError);
+        BYTE *profileData = nullptr;
+        unsigned int profileLength = 0;
+        REQUIRE(JsGetArrayBufferStorage(profile, &profileData, &profileLength) == JsNoError);
+        REQUIRE(profileLength > 0);
+
+        // Scripts that were never run have no profile to save
+        JsValueRef missing = JS_INVALID_REFERENCE;
+        CHECK(JsSerializeScriptProfile(sourceContext + 1, &missing) == JsErrorInvalidArgument);
+
+        JsRuntimeHandle second = JS_INVALID_RUNTIME_HANDLE;
+        JsContextRef secondContext = JS_INVALID_REFERENCE, current = JS_INVALID_REFERENCE;
+
+        REQUIRE(JsCreateRuntime(attributes, NULL, &second) == JsNoError);
+        REQUIRE(JsCreateContext(second, &secondContext) == JsNoError);
+        REQUIRE(JsGetCurrentContext(&current) == JsNoError);
+        REQUIRE(JsSetCurrentContext(secondContext) == JsNoError);
+
+        JsValueRef garbage = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateArrayBuffer(16, &garbage) == JsNoError);
+        CHECK(JsLoadScriptProfile(sourceContext, garbage) == JsErrorInvalidArgument);
+
+        JsValueRef copy = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateArrayBuffer(profileLength, &copy) == JsNoError);
+        BYTE *copyData = nullptr;
+        unsigned int copyLength = 0;
+        REQUIRE(JsGetArrayBufferStorage(copy, &copyData, &copyLength) == JsNoError);
+
+        // A profile damaged after it was saved fails its checksum
+        memcpy(copyData, profileData, profileLength);
+        copyData[profileLength - 1] ^= 0xFF;
+        CHECK(JsLoadScriptProfile(sourceContext, copy) == JsErrorInvalidArgument);
+
+        memcpy(copyData, profileData, profileLength);
+        CHECK(JsLoadScriptProfile(sourceContext, copy) == JsNoError);
+
+        REQUIRE(JsRunScript(script, sourceContext, _u(""), &result) == JsNoError);
+        REQUIRE(JsBooleanToBool(result, &boolValue) == JsNoError);
+        CHECK(boolValue);
+
+        // Too late once the script has been parsed
+        CHECK(JsLoadScriptProfile(sourceContext, copy) == JsErrorInvalidArgument);
+
+        REQUIRE(JsSetCurrentContext(current) == JsNoError);
+        REQUIRE(JsDisposeRuntime(second) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_ScriptProfileTest", "[ApiTest]")
+    {
+        JsRTApiTest::WithSetup(JsRuntimeAttributeEnableProfilePersistence, ScriptProfileTest);
+    }
+
+    void SharedJitThreadPoolTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Three runtimes queue bursts of large functions to the shared pool, one after the other, so the pool has work from all
+        // of them queued at once. On every job it hands out, a debug build's pool checks that no runtime with work waiting has
+        // been passed over more than once by each of the others (BackgroundJobProcessor::VerifyFairJobSelection), so the
+        // test fails on any thread timing in which a runtime is starved. All queues must drain in the end.
+        LPCWSTR burstScript = _u("for (var n = 0; n < 100; n++) {")
+            _u("    var body = 'var s = 0;';")
+            _u("    for (var k = 0; k < 60; k++) { body += 's += (a * ' + k + ') ^ (b + ' + (n + k) + '); if (s > 1e6) { s = s % 1000; }'; }")
+            _u("    var f = new Function('a', 'b', body + 'return s;');")
+            _u("    for (var i = 0; i < 100; i++) { f(i, n); }")
+            _u("}");
+        LPCWSTR script = _u("function f(a) { return a + 1; } var x = 0; for (var i = 0; i < 1000; i++) { x = f(x); } x == 1000;");
+
+        JsRuntimeHandle runtimes[3] = { runtime, JS_INVALID_RUNTIME_HANDLE, JS_INVALID_RUNTIME_HANDLE };
+        JsContextRef contexts[3] = { JS_INVALID_REFERENCE, JS_INVALID_REFERENCE, JS_INVALID_REFERENCE };
+        JsContextRef current = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetCurrentContext(&current) == JsNoError);
+        contexts[0] = current;
+        for (int r = 1; r < 3; r++)
+        {
+            REQUIRE(JsCreateRuntime(attributes, NULL, &runtimes[r]) == JsNoError);
+            REQUIRE(JsCreateContext(runtimes[r], &contexts[r]) == JsNoError);
+        }
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        bool boolValue;
+        for (int r = 0; r < 3; r++)
+        {
+            REQUIRE(JsSetCurrentContext(contexts[r]) == JsNoError);
+            REQUIRE(JsRunScript(burstScript, JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+            REQUIRE(JsRunScript(script, JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+            REQUIRE(JsBooleanToBool(result, &boolValue) == JsNoError);
+            CHECK(boolValue);
+        }
+        REQUIRE(JsSetCurrentContext(JS_INVALID_REFERENCE) == JsNoError);
+
+        unsigned int queueDepth = 0;
+        unsigned int runtimeQueueDepth = 0;
+        for (int i = 0; i < 30000; i++)
+        {
+            REQUIRE(JsGetSharedJitQueueDepth(&queueDepth) == JsNoError);
+            if (queueDepth == 0)
+            {
+                break;
+            }
+            Sleep(1);
+        }
+        CHECK(queueDepth == 0);
+
+        // Jobs being compiled are counted per runtime, so give the last ones a moment to finish
+        for (int r = 0; r < 3; r++)
+        {
+            for (int i = 0; i < 30000; i++)
+            {
+                REQUIRE(JsGetRuntimeJitQueueDepth(runtimes[r], &runtimeQueueDepth) == JsNoError);
+                if (runtimeQueueDepth == 0)
+                {
+                    break;
+                }
+                Sleep(1);
+            }
+            CHECK(runtimeQueueDepth == 0);
+        }
+
+        CHECK(JsGetSharedJitQueueDepth(nullptr) == JsErrorNullArgument);
+        CHECK(JsGetRuntimeJitQueueDepth(runtime, nullptr) == JsErrorNullArgument);
+
+        REQUIRE(JsSetCurrentContext(current) == JsNoError);
+        for (int r = 1; r < 3; r++)
+        {
+            REQUIRE(JsDisposeRuntime(runtimes[r]) == JsNoError);
+        }
+    }
+
+    TEST_CASE("ApiTest_SharedJitThreadPoolTest", "[ApiTest]")
+    {
+        JsRTApiTest::WithSetup(JsRuntimeAttributeEnableSharedJitThreadPool, SharedJitThreadPoolTest);
+    }
+
 #define BYTECODEWITHCALLBACK_METHODBODY _u("function test() { return true; }")
     typedef struct _ByteCodeCallbackTracker
     {
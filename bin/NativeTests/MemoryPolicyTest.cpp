@@ -95,6 +95,228 @@ namespace MemoryPolicyTests
         BasicTest(JsRuntimeAttributeDisableBackgroundWork, "arraybuffer.js");
     }
 
+    TEST_CASE("MemoryPolicyTest_LazyZeroedMemory", "[MemoryPolicyTest]")
+    {
+        JsRuntimeHandle runtime = JS_INVALID_RUNTIME_HANDLE;
+        REQUIRE(JsCreateRuntime(JsRuntimeAttributeNone, nullptr, &runtime) == JsNoError);
+
+        JsContextRef context = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateContext(runtime, &context) == JsNoError);
+        REQUIRE(JsSetCurrentContext(context) == JsNoError);
+        REQUIRE(JsRunScript(_u("for (var j = 0; j < 20; j++) { var a = []; for (var i = 0; i < 20000; i++) { a.push({ i: i }); } }"), JS_SOURCE_CONTEXT_NONE, _u(""), nullptr) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+
+        size_t lazyZeroedMemory;
+        size_t secondLazyZeroedMemory;
+        REQUIRE(JsGetRuntimeLazyZeroedMemory(runtime, &lazyZeroedMemory) == JsNoError);
+#ifdef _WIN32
+        // Freed pages are zeroed in the background instead
+        CHECK(lazyZeroedMemory == 0);
+#endif
+
+        // The total only grows
+        REQUIRE(JsRunScript(_u("for (var j = 0; j < 20; j++) { var a = []; for (var i = 0; i < 20000; i++) { a.push({ i: i }); } }"), JS_SOURCE_CONTEXT_NONE, _u(""), nullptr) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        REQUIRE(JsGetRuntimeLazyZeroedMemory(runtime, &secondLazyZeroedMemory) == JsNoError);
+        CHECK(secondLazyZeroedMemory >= lazyZeroedMemory);
+        CHECK(JsGetRuntimeLazyZeroedMemory(runtime, nullptr) == JsErrorNullArgument);
+
+        REQUIRE(JsSetCurrentContext(JS_INVALID_REFERENCE) == JsNoError);
+        REQUIRE(JsDisposeRuntime(runtime) == JsNoError);
+    }
+
+    TEST_CASE("MemoryPolicyTest_HugePageUsage", "[MemoryPolicyTest]")
+    {
+        JsRuntimeHandle runtime = JS_INVALID_RUNTIME_HANDLE;
+        REQUIRE(JsCreateRuntime(JsRuntimeAttributeEnableHugePages, nullptr, &runtime) == JsNoError);
+
+        JsContextRef context = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateContext(runtime, &context) == JsNoError);
+        REQUIRE(JsSetCurrentContext(context) == JsNoError);
+        // Arrays this large get segments of their own, which are big enough to be huge page backed
+        REQUIRE(JsRunScript(_u("var a = []; for (var i = 0; i < 4; i++) { a.push(new Array(1024 * 1024).fill(i)); }"), JS_SOURCE_CONTEXT_NONE, _u(""), nullptr) == JsNoError);
+
+        size_t memoryUsage;
+        size_t hugePageMemoryUsage;
+        REQUIRE(JsGetRuntimeMemoryUsage(runtime, &memoryUsage) == JsNoError);
+        REQUIRE(JsGetRuntimeHugePageMemoryUsage(runtime, &hugePageMemoryUsage) == JsNoError);
+        // Whether any pages are promoted depends on the kernel's transparent huge page setting
+        CHECK(hugePageMemoryUsage <= memoryUsage);
+#ifndef __linux__
+        CHECK(hugePageMemoryUsage == 0);
+#endif
+
+        REQUIRE(JsSetCurrentContext(JS_INVALID_REFERENCE) == JsNoError);
+        REQUIRE(JsDisposeRuntime(runtime) == JsNoError);
+    }
+
+    JsRuntimeHandle CreateRuntimeAndRunScript(JsRuntimeAttributes attributes, LPCWSTR script)
+    {
+        JsRuntimeHandle runtime = JS_INVALID_RUNTIME_HANDLE;
+        REQUIRE(JsCreateRuntime(attributes, nullptr, &runtime) == JsNoError);
+
+        JsContextRef context = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateContext(runtime, &context) == JsNoError);
+        REQUIRE(JsSetCurrentContext(context) == JsNoError);
+        REQUIRE(JsRunScript(script, JS_SOURCE_CONTEXT_NONE, _u(""), nullptr) == JsNoError);
+        REQUIRE(JsSetCurrentContext(JS_INVALID_REFERENCE) == JsNoError);
+        return runtime;
+    }
+
+    void VerifyNumaAllocation(DWORD preferredNode)
+    {
+        const SIZE_T size = 64 * 1024;
+        char * address = (char *)VirtualAllocExNuma(GetCurrentProcess(), nullptr, size, MEM_RESERVE, PAGE_READWRITE, preferredNode);
+        REQUIRE(address != nullptr);
+        REQUIRE(VirtualAlloc(address, size, MEM_COMMIT, PAGE_READWRITE) == address);
+        memset(address, 0xAB, size);
+        CHECK(address[0] == (char)0xAB);
+        CHECK(address[size - 1] == (char)0xAB);
+        REQUIRE(VirtualFree(address, 0, MEM_RELEASE));
+    }
+
+    TEST_CASE("MemoryPolicyTest_NumaAffinity", "[MemoryPolicyTest]")
+    {
+        ULONG highestNode;
+        REQUIRE(GetNumaHighestNodeNumber(&highestNode));
+
+        UCHAR processorNode;
+        REQUIRE(GetNumaProcessorNode(0, &processorNode));
+        CHECK(processorNode <= highestNode);
+        // A processor the host doesn't have has no node
+        SYSTEM_INFO systemInfo;
+        GetSystemInfo(&systemInfo);
+        if (systemInfo.dwNumberOfProcessors <= UCHAR_MAX)
+        {
+            CHECK(!GetNumaProcessorNode(UCHAR_MAX, &processorNode));
+            CHECK(processorNode == 0xFF);
+        }
+
+        // Segments can be reserved on every node, and on node 0 of a host without NUMA
+        for (ULONG node = 0; node <= highestNode; node++)
+        {
+            VerifyNumaAllocation(node);
+        }
+        VerifyNumaAllocation(NUMA_NO_PREFERRED_NODE);
+
+#ifndef _WIN32
+        // The PAL treats the node as a hint, so a node the host doesn't have falls back to any node
+        VerifyNumaAllocation(highestNode + 1);
+#endif
+
+        // A runtime bound to the node of the current thread collects and reuses its segments as usual
+        JsRuntimeHandle runtime = CreateRuntimeAndRunScript(JsRuntimeAttributeEnableNumaAffinity,
+            _u("var a = []; for (var i = 0; i < 100000; i++) { if (i % 10000 == 0) { a = []; } a.push({ i: i }); }")
+            _u("for (var i = 0; i < a.length; i++) { if (a[i].i % 10000 != i) { throw new Error(); } }"));
+        REQUIRE(JsDisposeRuntime(runtime) == JsNoError);
+    }
+
+    TEST_CASE("MemoryPolicyTest_SharedPagePool", "[MemoryPolicyTest]")
+    {
+        LPCWSTR script = _u("var a = []; for (var i = 0; i < 100000; i++) { a.push({ i: i }); }");
+        unsigned int cachedSegmentCount;
+        size_t reuseCount;
+        unsigned int initialCachedSegmentCount;
+        size_t initialReuseCount;
+        REQUIRE(JsGetSharedPagePoolInfo(&initialCachedSegmentCount, &initialReuseCount) == JsNoError);
+
+        // A runtime without the attribute neither gives its segments to the pool nor takes any
+        JsRuntimeHandle runtime = CreateRuntimeAndRunScript(JsRuntimeAttributeNone, script);
+        REQUIRE(JsDisposeRuntime(runtime) == JsNoError);
+        REQUIRE(JsGetSharedPagePoolInfo(&cachedSegmentCount, &reuseCount) == JsNoError);
+        CHECK(cachedSegmentCount == initialCachedSegmentCount);
+        CHECK(reuseCount == initialReuseCount);
+
+        // Disposing a runtime releases its segments to the pool, up to the pool's size
+        runtime = CreateRuntimeAndRunScript(JsRuntimeAttributeEnableSharedPagePool, script);
+        REQUIRE(JsDisposeRuntime(runtime) == JsNoError);
+        REQUIRE(JsGetSharedPagePoolInfo(&cachedSegmentCount, &reuseCount) == JsNoError);
+        CHECK(cachedSegmentCount > initialCachedSegmentCount);
+        CHECK(cachedSegmentCount <= 16);
+        unsigned int releasedSegmentCount = cachedSegmentCount;
+
+        // The next runtime takes them back instead of allocating new segments, and is charged for them
+        runtime = CreateRuntimeAndRunScript(JsRuntimeAttributeEnableSharedPagePool, script);
+        REQUIRE(JsGetSharedPagePoolInfo(&cachedSegmentCount, &reuseCount) == JsNoError);
+        CHECK(cachedSegmentCount < releasedSegmentCount);
+        CHECK(reuseCount > initialReuseCount);
+
+        size_t memoryUsage;
+        REQUIRE(JsGetRuntimeMemoryUsage(runtime, &memoryUsage) == JsNoError);
+        CHECK(memoryUsage > 0);
+
+        // Reused segments come back zeroed, so the runtime still works
+        JsContextRef context = JS_INVALID_REFERENCE;
+        JsValueRef result = JS_INVALID_REFERENCE;
+        bool boolValue;
+        REQUIRE(JsCreateContext(runtime, &context) == JsNoError);
+        REQUIRE(JsSetCurrentContext(context) == JsNoError);
+        REQUIRE(JsRunScript(_u("var o = {}; for (var i = 0; i < 10000; i++) { o['p' + i] = [i]; } o.p9999[0] === 9999 && o.q === undefined;"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsBooleanToBool(result, &boolValue) == JsNoError);
+        CHECK(boolValue);
+        REQUIRE(JsSetCurrentContext(JS_INVALID_REFERENCE) == JsNoError);
+        REQUIRE(JsDisposeRuntime(runtime) == JsNoError);
+
+        REQUIRE(JsGetSharedPagePoolInfo(&cachedSegmentCount, &reuseCount) == JsNoError);
+        CHECK(cachedSegmentCount <= 16);
+        CHECK(JsGetSharedPagePoolInfo(nullptr, &reuseCount) == JsErrorNullArgument);
+        CHECK(JsGetSharedPagePoolInfo(&cachedSegmentCount, nullptr) == JsErrorNullArgument);
+    }
+
+    TEST_CASE("MemoryPolicyTest_ParallelMarkThreadCount", "[MemoryPolicyTest]")
+    {
+        JsRuntimeHandle runtime = JS_INVALID_RUNTIME_HANDLE;
+        REQUIRE(JsCreateRuntime(JsRuntimeAttributeNone, nullptr, &runtime) == JsNoError);
+
+        unsigned int threadCount;
+#ifndef _WIN32
+        // No parallel mark without concurrent GC
+        CHECK(JsSetRuntimeParallelMarkThreadCount(runtime, 2) == JsErrorNotImplemented);
+        CHECK(JsGetRuntimeParallelMarkThreadCount(runtime, &threadCount) == JsErrorNotImplemented);
+        CHECK(threadCount == 0);
+#else
+        unsigned int maxThreadCount;
+        REQUIRE(JsSetRuntimeParallelMarkThreadCount(runtime, 100) == JsNoError);
+        REQUIRE(JsGetRuntimeParallelMarkThreadCount(runtime, &maxThreadCount) == JsNoError);
+        CHECK(maxThreadCount >= 1);
+        CHECK(maxThreadCount <= 4);
+
+        REQUIRE(JsSetRuntimeParallelMarkThreadCount(runtime, 0) == JsNoError);
+        REQUIRE(JsGetRuntimeParallelMarkThreadCount(runtime, &threadCount) == JsNoError);
+        CHECK(threadCount == 1);
+
+        // Marking with fewer threads must still find everything
+        JsContextRef context = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateContext(runtime, &context) == JsNoError);
+        REQUIRE(JsSetCurrentContext(context) == JsNoError);
+        for (unsigned int i = 1; i <= maxThreadCount; i++)
+        {
+            REQUIRE(JsSetRuntimeParallelMarkThreadCount(runtime, i) == JsNoError);
+            REQUIRE(JsGetRuntimeParallelMarkThreadCount(runtime, &threadCount) == JsNoError);
+            CHECK(threadCount == i);
+
+            JsValueRef result;
+            REQUIRE(JsRunScript(_u("var t = []; for (var i = 0; i < 50000; i++) { t.push({ i: i, next: t[i - 1] }); }"), JS_SOURCE_CONTEXT_NONE, _u(""), nullptr) == JsNoError);
+            REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+            REQUIRE(JsRunScript(_u("var n = 0; for (var o = t[t.length - 1]; o; o = o.next) { n++; } n === 50000"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+            bool allMarked;
+            REQUIRE(JsBooleanToBool(result, &allMarked) == JsNoError);
+            CHECK(allMarked);
+        }
+
+        REQUIRE(JsSetCurrentContext(JS_INVALID_REFERENCE) == JsNoError);
+#endif
+
+        // Arguments are checked before reporting the feature as missing
+        CHECK(JsGetRuntimeParallelMarkThreadCount(runtime, nullptr) == JsErrorNullArgument);
+        CHECK(JsGetRuntimeParallelMarkThreadCount(JS_INVALID_RUNTIME_HANDLE, &threadCount) == JsErrorInvalidArgument);
+        CHECK(JsSetRuntimeParallelMarkThreadCount(JS_INVALID_RUNTIME_HANDLE, 2) == JsErrorInvalidArgument);
+
+        REQUIRE(JsDisposeRuntime(runtime) == JsNoError);
+    }
+
     void OOSTest(JsRuntimeAttributes attributes)
     {
         JsPropertyIdRef property;
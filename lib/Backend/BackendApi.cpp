@@ -28,6 +28,12 @@ IsClosedNativeCodeGenerator(NativeCodeGenerator * nativeCodeGen)
     return nativeCodeGen->IsClosed();
 }
 
+uint
+GetQueuedJobCountNativeCodeGen(NativeCodeGenerator * nativeCodeGen)
+{
+    return nativeCodeGen->NumberOfJobsAddedToProcessor();
+}
+
 void SetProfileModeNativeCodeGen(NativeCodeGenerator *pNativeCodeGen, BOOL fSet)
 {
     pNativeCodeGen->SetProfileMode(fSet);
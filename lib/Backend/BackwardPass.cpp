@@ -1576,7 +1576,7 @@ BackwardPass::ProcessLoop(BasicBlock * lastBlock)
 void
 BackwardPass::OptBlock(BasicBlock * block)
 {
-    this->func->ThrowIfScriptClosed();
+    this->func->ThrowIfAborted();
 
     if (block->loop && !block->loop->hasDeadStorePrepass)
     {
@@ -124,6 +124,9 @@ void CodeGenWorkItem::OnAddToJitQueue()
     Assert(!this->isInJitQueue);
     this->isInJitQueue = true;
     VerifyJitMode();
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    this->queuedTime = Js::Tick::Now();
+#endif
 
     this->entryPointInfo->SetCodeGenQueued();
     if(IS_JS_ETW(EventEnabledJSCRIPT_FUNCTION_JIT_QUEUED()))
@@ -90,6 +90,10 @@ private:
     QueuedFullJitWorkItem *queuedFullJitWorkItem;
     EmitBufferAllocation<VirtualAllocWrapper, PreReservedVirtualAllocWrapper> *allocation;
 
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    Js::Tick queuedTime;                // when the work item was last added to the jit queue, for -trace:JitQueueRanking
+#endif
+
 #ifdef IR_VIEWER
 public:
     bool isRejitIRViewerFunction;               // re-JIT function for IRViewer object generation
@@ -172,6 +176,13 @@ public:
         return isInJitQueue;
     }
 
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    Js::TickDelta GetTimeInJitQueue() const
+    {
+        return Js::Tick::Now() - queuedTime;
+    }
+#endif
+
     bool IsJitInDebugMode() const
     {
         return jitData.isJitInDebugMode != 0;
@@ -397,7 +397,7 @@ Func::TryCodegen()
 
         END_CODEGEN_PHASE(this, Js::InlinePhase);
 
-        ThrowIfScriptClosed();
+        ThrowIfAborted();
 
         // FlowGraph
         {
@@ -428,7 +428,7 @@ Func::TryCodegen()
         IRtoJSObjectBuilder::DumpIRtoGlobalObject(this, Js::GlobOptPhase);
 #endif /* IR_VIEWER */
 
-        ThrowIfScriptClosed();
+        ThrowIfAborted();
 
         // Lowering
         Lowerer lowerer(this);
@@ -454,6 +454,8 @@ Func::TryCodegen()
             END_CODEGEN_PHASE(this, Js::InterruptProbePhase)
         }
 
+        ThrowIfAborted();
+
         // Register Allocation
 
         BEGIN_CODEGEN_PHASE(this, Js::RegAllocPhase);
@@ -467,7 +469,7 @@ Func::TryCodegen()
         IRtoJSObjectBuilder::DumpIRtoGlobalObject(this, Js::RegAllocPhase);
 #endif /* IR_VIEWER */
 
-        ThrowIfScriptClosed();
+        ThrowIfAborted();
 
         // Peephole optimizations
 
@@ -1730,6 +1732,19 @@ void Func::ThrowIfScriptClosed()
     }
 }
 
+void Func::ThrowIfAborted()
+{
+    ThrowIfScriptClosed();
+
+    // A rejit may have replaced the entry point this code is being generated for while the job was in flight. Nothing
+    // would call the result, so stop at the next phase boundary. The out-of-proc JIT doesn't have the entry point and
+    // always runs to completion.
+    if (!IsOOPJIT() && m_entryPointInfo && m_entryPointInfo->IsCodeGenAbandoned())
+    {
+        throw Js::OperationAbortedException();
+    }
+}
+
 IR::IndirOpnd * Func::GetConstantAddressIndirOpnd(intptr_t address, IR::Opnd * largeConstOpnd, IR::AddrOpndKind kind, IRType type, Js::OpCode loadOpCode)
 {
     Assert(this->GetTopFunc() == this);
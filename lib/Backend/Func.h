@@ -439,6 +439,7 @@ static const unsigned __int64 c_debugFillPattern8 = 0xcececececececece;
     Js::JitEquivalentTypeGuard * CreateEquivalentTypeGuard(JITTypeHolder type, uint32 objTypeSpecFldId);
 
     void ThrowIfScriptClosed();
+    void ThrowIfAborted();
     void EnsurePropertyGuardsByPropertyId();
     void EnsureCtorCachesByPropertyId();
 
@@ -130,6 +130,10 @@ Inline::Optimize(Func *func, __in_ecount_opt(callerArgOutCount) IR::Instr *calle
                     Assert(symOpnd->AsSymOpnd()->IsPropertySymOpnd());
 
                     const auto inlineCacheIndex = symOpnd->AsPropertySymOpnd()->m_inlineCacheIndex;
+                    // Only one accessor inlinee is kept per inline cache, so getters at polymorphic sites aren't
+                    // inlined. That would need several inlinees per cache and a type switch like the one for
+                    // polymorphic calls. Calls through bound functions and apply/call nested more than one level
+                    // aren't inlined either; test/benchmarks/Micro/middleware-dispatch.js measures all three.
                     const FunctionJITTimeInfo * inlineeData = inlinerData->GetLdFldInlinee(inlineCacheIndex);
                     if (!inlineeData)
                     {
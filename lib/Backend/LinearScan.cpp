@@ -98,6 +98,11 @@ bool LoweredBasicBlock::Equals(LoweredBasicBlock* otherBlock)
 void
 LinearScan::RegAlloc()
 {
+#ifdef BGJIT_STATS
+    const Js::Tick startTime = Js::Tick::Now();
+#endif
+    this->isFastAllocation = this->ShouldUseFastAllocation();
+
     NoRecoverMemoryJitArenaAllocator tempAlloc(_u("BE-LinearScan"), this->func->m_alloc->GetPageAllocator(), Js::Throw::OutOfMemory);
     this->tempAlloc = &tempAlloc;
     this->opHelperSpilledLiveranges = JitAnew(&tempAlloc, SList<Lifetime *>, &tempAlloc);
@@ -303,6 +308,51 @@ LinearScan::RegAlloc()
     }
 #endif // DBG_DUMP
     DebugOnly(this->func->allowRemoveBailOutArgInstr = true);
+
+#ifdef BGJIT_STATS
+    const uint regAllocTime = (uint)(Js::Tick::Now() - startTime).ToMicroseconds();
+    if (!this->func->IsOOPJIT())
+    {
+        Js::ScriptContext *const scriptContext = this->func->GetScriptContext();
+        InterlockedExchangeAdd(&scriptContext->regAllocTime, regAllocTime);
+        if (this->isFastAllocation)
+        {
+            InterlockedIncrement(&scriptContext->fastRegAllocCount);
+        }
+    }
+
+    char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+    OUTPUT_VERBOSE_STATS(Js::BGJitPhase, _u("RegAlloc: %-30s %16s %-9s syms: %8u, %s allocation, %8u us\n"),
+        this->func->GetJITFunctionBody()->GetDisplayName(),
+        this->func->GetDebugNumberSet(debugStringBuffer),
+        this->func->IsSimpleJit() ? _u("SimpleJit") : _u("FullJit"),
+        this->func->m_symTable->GetMaxSymID(),
+        this->isFastAllocation ? _u("fast") : _u("full"),
+        regAllocTime);
+#endif
+}
+
+// The parts of linear scan that look beyond the current lifetime - second chance allocation at block boundaries, spill
+// costs weighted by use counts in the enclosing loop, and hoisting reloads out of loops - get expensive on functions with
+// tens of thousands of syms. Simple JIT'ed code is short-lived anyway, so leave them out there too.
+// The code quality cost hasn't been measured against the compile time saved yet, so this is opt-in: -on:FastRegAlloc
+// applies it to those functions, and -force:FastRegAlloc to every function.
+bool
+LinearScan::ShouldUseFastAllocation() const
+{
+    if (PHASE_OFF(Js::FastRegAllocPhase, this->func))
+    {
+        return false;
+    }
+    if (PHASE_FORCE(Js::FastRegAllocPhase, this->func))
+    {
+        return true;
+    }
+    if (!PHASE_ON(Js::FastRegAllocPhase, this->func))
+    {
+        return false;
+    }
+    return this->func->IsSimpleJit() || this->func->m_symTable->GetMaxSymID() >= (SymID)CONFIG_FLAG(FastRegAllocSymCount);
 }
 
 JitArenaAllocator *
@@ -3697,7 +3747,7 @@ LinearScan::GetSpillCost(Lifetime *lifetime)
     uint end = max(start, lifetime->end);
     uint lifetimeTotalOpHelperFullVisitedLength = lifetime->totalOpHelperLengthByEnd;
 
-    if (this->curLoop && this->curLoop->regAlloc.loopEnd < end && !PHASE_OFF(Js::RegionUseCountPhase, this->func))
+    if (this->curLoop && this->curLoop->regAlloc.loopEnd < end && !PHASE_OFF(Js::RegionUseCountPhase, this->func) && !this->isFastAllocation)
     {
         end = this->curLoop->regAlloc.loopEnd;
         lifetimeTotalOpHelperFullVisitedLength  = this->curLoop->regAlloc.helperLength;
@@ -4476,7 +4526,7 @@ void LinearScan::AvoidCompensationConflicts(IR::LabelInstr *labelInstr, IR::Bran
 RegNum
 LinearScan::SecondChanceAllocation(Lifetime *lifetime, bool force)
 {
-    if (PHASE_OFF(Js::SecondChancePhase, this->func) || this->func->HasTry())
+    if (PHASE_OFF(Js::SecondChancePhase, this->func) || this->isFastAllocation || this->func->HasTry())
     {
         return RegNOREG;
     }
@@ -4711,7 +4761,7 @@ IR::Instr * LinearScan::TryHoistLoad(IR::Instr *instr, Lifetime *lifetime)
     RegNum reg = lifetime->reg;
     IR::Instr *insertInstr = instr;
 
-    if (PHASE_OFF(Js::RegHoistLoadsPhase, this->func))
+    if (PHASE_OFF(Js::RegHoistLoadsPhase, this->func) || this->isFastAllocation)
     {
         return insertInstr;
     }
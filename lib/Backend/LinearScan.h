@@ -94,6 +94,7 @@ private:
     SList<Lifetime *> * stackPackInUseLiveRanges;
     SList<StackSlot *> *stackSlotsFreeList;
     LoweredBasicBlock  *currentBlock;
+    bool                isFastAllocation;           // Skip the second chance allocation, region use counts, and hoisting of reloads out of loops
 #if DBG
     BitVector           nonAllocatableRegs;
 #endif
@@ -102,7 +103,7 @@ public:
         linearScanMD(func), opHelperSpilledLiveranges(NULL), currentOpHelperBlock(NULL),
         lastLabel(NULL), numInt32Regs(0), numFloatRegs(0), stackPackInUseLiveRanges(NULL), stackSlotsFreeList(NULL),
         totalOpHelperFullVisitedLength(0), curLoop(NULL), currentBlock(nullptr), currentRegion(nullptr), m_bailOutRecordCount(0),
-        globalBailOutRecordTables(nullptr), lastUpdatedRowIndices(nullptr)
+        globalBailOutRecordTables(nullptr), lastUpdatedRowIndices(nullptr), isFastAllocation(false)
     {
     }
 
@@ -118,6 +119,7 @@ public:
 
 private:
     void                Init();
+    bool                ShouldUseFastAllocation() const;
     bool                SkipNumberedInstr(IR::Instr *instr);
     void                EndDeadLifetimes(IR::Instr *instr);
     void                EndDeadOpHelperLifetimes(IR::Instr *instr);
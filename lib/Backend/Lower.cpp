@@ -5185,7 +5185,23 @@ Lowerer::GenerateRecyclerAllocAligned(IR::JnHelperMethod allocHelper, size_t all
         IR::LabelInstr * allocHelperLabel = IR::LabelInstr::New(Js::OpCode::Label, this->m_func, true);
         allocDoneLabel = IR::LabelInstr::New(Js::OpCode::Label, this->m_func, inOpHelper);
 
-        this->m_lowererMD.GenerateFastRecyclerAlloc(allocSize, newObjDst, insertionPointInstr, allocHelperLabel, allocDoneLabel);
+#ifdef RECYCLER_NATIVE_FREE_LIST_ALLOC
+        if (!PHASE_OFF(Js::JitAllocFreeListPhase, insertionPointInstr->m_func) &&
+            insertionPointInstr->m_func->GetScriptContextInfo()->GetRecyclerAllowNativeCodeBumpAllocation())
+        {
+            IR::LabelInstr * freeListAllocLabel = IR::LabelInstr::New(Js::OpCode::Label, this->m_func, true);
+
+            this->m_lowererMD.GenerateFastRecyclerAlloc(allocSize, newObjDst, insertionPointInstr, freeListAllocLabel, allocDoneLabel);
+
+            // $freeListAlloc:
+            insertionPointInstr->InsertBefore(freeListAllocLabel);
+            this->GenerateFreeListRecyclerAlloc(allocSize, newObjDst, insertionPointInstr, allocHelperLabel, allocDoneLabel);
+        }
+        else
+#endif
+        {
+            this->m_lowererMD.GenerateFastRecyclerAlloc(allocSize, newObjDst, insertionPointInstr, allocHelperLabel, allocDoneLabel);
+        }
 
         // $allocHelper:
         insertionPointInstr->InsertBefore(allocHelperLabel);
@@ -5205,6 +5221,54 @@ Lowerer::GenerateRecyclerAllocAligned(IR::JnHelperMethod allocHelper, size_t all
     }
 }
 
+#ifdef RECYCLER_NATIVE_FREE_LIST_ALLOC
+void
+Lowerer::GenerateFreeListRecyclerAlloc(size_t allocSize, IR::RegOpnd* newObjDst, IR::Instr* insertionPointInstr, IR::LabelInstr* allocHelperLabel, IR::LabelInstr* allocDoneLabel)
+{
+    // The bump allocation check failed. If the allocator is handing out a swept block's free list
+    // rather than bump allocating, take the head of the list here instead of calling the helper.
+    //
+    //      CMP allocator->endAddress, 0
+    //      JNE $allocHelper
+    //      MOV newObjDst, allocator->freeObjectList
+    //      TEST newObjDst, newObjDst
+    //      JEQ $allocHelper
+    //      MOV nextFreeObject, [newObjDst]
+    //      AND nextFreeObject, ~taggedBit
+    //      MOV allocator->freeObjectList, nextFreeObject
+    //      MOV [newObjDst], 0
+    //      JMP $allocDone
+
+    ScriptContextInfo* scriptContext = this->m_func->GetScriptContextInfo();
+    void* allocatorAddress;
+    uint32 endAddressOffset;
+    uint32 freeListOffset;
+    Recycler::GetNormalHeapBlockAllocatorInfoForNativeAllocation((void*)scriptContext->GetRecyclerAddr(), HeapInfo::GetAlignedSizeNoCheck(allocSize),
+        allocatorAddress, endAddressOffset, freeListOffset,
+        true /* allowBumpAllocation */, this->m_func->IsOOPJIT());
+
+    IR::Opnd * endAddressOpnd = IR::MemRefOpnd::New((char*)allocatorAddress + endAddressOffset, TyMachPtr, this->m_func, IR::AddrOpndKindDynamicRecyclerAllocatorEndAddressRef);
+    IR::Opnd * freeListOpnd = IR::MemRefOpnd::New((char*)allocatorAddress + freeListOffset, TyMachPtr, this->m_func, IR::AddrOpndKindDynamicRecyclerAllocatorFreeListRef);
+
+    // A non-null end address means the allocator is in bump mode and the current block is exhausted
+    InsertCompareBranch(endAddressOpnd, IR::AddrOpnd::NewNull(this->m_func), Js::OpCode::BrNeq_A, allocHelperLabel, insertionPointInstr);
+
+    InsertMove(newObjDst, freeListOpnd, insertionPointInstr);
+    InsertTestBranch(newObjDst, newObjDst, Js::OpCode::BrEq_A, allocHelperLabel, insertionPointInstr);
+
+    // Free objects link through their first word, tagged so that the list can be told apart from object data
+    IR::RegOpnd * nextFreeObjectOpnd = IR::RegOpnd::New(TyMachPtr, this->m_func);
+    InsertMove(nextFreeObjectOpnd, IR::IndirOpnd::New(newObjDst, 0, TyMachPtr, this->m_func), insertionPointInstr);
+    InsertAnd(nextFreeObjectOpnd, nextFreeObjectOpnd, IR::IntConstOpnd::New(~FreeObject::GetTaggedBit(), TyMachReg, this->m_func, true), insertionPointInstr);
+    InsertMove(freeListOpnd, nextFreeObjectOpnd, insertionPointInstr);
+
+    // Swept objects are zeroed except for the link word; clear it to match AllocZero
+    InsertMove(IR::IndirOpnd::New(newObjDst, 0, TyMachPtr, this->m_func), IR::AddrOpnd::NewNull(this->m_func), insertionPointInstr);
+
+    InsertBranch(Js::OpCode::Br, allocDoneLabel, insertionPointInstr);
+}
+#endif
+
 IR::Instr *
 Lowerer::LowerGetNewScObject(IR::Instr *instr)
 {
@@ -18,6 +18,11 @@
 
 #define FixupNativeDataPointer(field, chunkList) NativeCodeData::AddFixupEntry(this->field, &this->field, this, chunkList)
 
+// The data JIT'd code refers to. The fixup entries relocate pointers from one chunk of this data to another when
+// it is copied out of the JIT process. They don't cover the addresses of function bodies, types, property records
+// and inline caches that the encoder writes into the code itself, so native code only runs in the process that
+// produced it. That is why it isn't saved with serialized byte code: a persistent cache would have to record each
+// of those addresses as a relocation and revalidate every guard that depends on them when the code is loaded.
 class NativeCodeData
 {
 
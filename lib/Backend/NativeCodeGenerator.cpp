@@ -526,7 +526,9 @@ NativeCodeGenerator::GenerateFunction(Js::FunctionBody *fn, Js::ScriptFunction *
 
     if (function != nullptr)
     {
+        Js::FunctionEntryPointInfo *const previousEntryPointInfo = fn->GetDefaultFunctionEntryPointInfo();
         entryPointInfo = fn->CreateNewDefaultEntryPoint();
+        AbandonSupersededCodeGen(previousEntryPointInfo);
     }
     else
     {
@@ -610,6 +612,11 @@ NativeCodeGenerator::GenerateFunction(Js::FunctionBody *fn, Js::ScriptFunction *
 #endif
 }
 
+// Loop bodies are compiled as their own entry points. The interpreter frame calls into one at the loop header and gets
+// control back at loop exit, since it owns the function's locals. Nothing moves a running loop into the full JIT'd
+// function: that would need a map from the interpreter frame's registers to the full function's stack syms at each
+// loop header, and GlobOpt would have to treat every loop header as an entry block. The next call to the function
+// picks up the full JIT entry point once it is ready.
 void NativeCodeGenerator::GenerateLoopBody(Js::FunctionBody * fn, Js::LoopHeader * loopHeader, Js::EntryPointInfo* entryPoint, uint localCount, Js::Var localSlots[])
 {
     ASSERT_THREAD();
@@ -1690,6 +1697,35 @@ NativeCodeGenerator::ShouldProcessInForeground(const bool willWaitForJob, const
             (CONFIG_FLAG(HybridFgJit) || isOptimizedForManyInstances));
 }
 
+bool
+NativeCodeGenerator::ShouldProcessBefore(JsUtil::Job *const queuedJob, JsUtil::Job *const job) const
+{
+    // This function is called from inside the lock
+
+    ASSERT_THREAD();
+    Assert(queuedJob);
+    Assert(job);
+    Assert(queuedJob != job);
+
+    // Jobs of other managers sharing the job processor keep their place
+    if(queuedJob->Manager() != this || PHASE_OFF1(Js::JitQueueRankingPhase))
+    {
+        return false;
+    }
+
+    // Full JIT work items stay ahead of simple JIT work items. Otherwise, order by how often the function was called or the
+    // loop iterated in the interpreter so far. Work items are ranked again with their current counts each time the function
+    // is called while it's waiting and each time another work item is queued, so one hot loop body doesn't wait behind every
+    // lukewarm function that was queued after it.
+    const CodeGenWorkItem *const queuedWorkItem = static_cast<const CodeGenWorkItem *>(queuedJob);
+    const CodeGenWorkItem *const workItem = static_cast<const CodeGenWorkItem *>(job);
+    if(queuedWorkItem->GetJitMode() != workItem->GetJitMode())
+    {
+        return queuedWorkItem->GetJitMode() == ExecutionMode::FullJit;
+    }
+    return queuedWorkItem->GetInterpretedCount() > workItem->GetInterpretedCount();
+}
+
 void
 NativeCodeGenerator::PrioritizedButNotYetProcessed(JsUtil::Job *const job)
 {
@@ -1770,6 +1806,31 @@ NativeCodeGenerator::Process(JsUtil::Job *const job, JsUtil::ParallelThreadData
 
     CodeGenWorkItem *const codeGenWork = static_cast<CodeGenWorkItem *>(job);
 
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    if (PHASE_TRACE(Js::JitQueueRankingPhase, codeGenWork->GetFunctionBody()))
+    {
+        WCHAR displayNameBuffer[256];
+        WCHAR* displayName = displayNameBuffer;
+        size_t sizeInChars = codeGenWork->GetDisplayName(displayName, 256);
+        if (sizeInChars > 256)
+        {
+            displayName = HeapNewArray(WCHAR, sizeInChars);
+            codeGenWork->GetDisplayName(displayName, sizeInChars);
+        }
+        Output::Print(_u("JitQueue: %-30s %s, interpreted count: %6u, queued for: %8lld us%s\n"),
+            displayName,
+            codeGenWork->GetJitMode() == ExecutionMode::FullJit ? _u("FullJit  ") : _u("SimpleJit"),
+            codeGenWork->GetInterpretedCount(),
+            codeGenWork->GetTimeInJitQueue().ToMicroseconds(),
+            foreground ? _u(" (foreground)") : _u(""));
+        Output::Flush();
+        if (displayName != displayNameBuffer)
+        {
+            HeapDeleteArray(sizeInChars, displayName);
+        }
+    }
+#endif
+
     switch (codeGenWork->Type())
     {
     case JsLoopBodyWorkItemType:
@@ -1872,6 +1933,70 @@ NativeCodeGenerator::Prioritize(JsUtil::Job *const job, const bool forceAddJobTo
     }
 }
 
+// Called when a new default entry point replaced the given one, for instance on a rejit. Code gen that is still pending
+// for the old entry point would produce code that nothing calls anymore, so it's coalesced into the new work item: it's
+// dropped if the backend hasn't started on it, or else the backend is told to give up at its next phase boundary.
+void NativeCodeGenerator::AbandonSupersededCodeGen(Js::FunctionEntryPointInfo *const entryPoint)
+{
+    ASSERT_THREAD();
+    Assert(entryPoint);
+
+    if(PHASE_OFF1(Js::JitCancellationPhase) || entryPoint->GetIsAsmJSFunction())
+    {
+        return;
+    }
+
+    // The background thread finishes jobs and deletes their work items while holding this lock, so the entry point's
+    // state and work item can only be relied upon once we hold it too.
+    AutoOptionalCriticalSection lock(Processor()->GetCriticalSection());
+
+    if(!entryPoint->IsCodeGenPending() && !entryPoint->IsCodeGenQueued())
+    {
+        return;
+    }
+
+    CodeGenWorkItem *const workItem = entryPoint->GetWorkItem();
+    if(workItem == nullptr)
+    {
+        return;
+    }
+    Assert(workItem->Type() == JsFunctionType);
+
+    Js::FunctionBody *const functionBody = workItem->GetFunctionBody();
+    bool inFlight = false;
+    if(!workItem->IsInJitQueue())
+    {
+        workItems.Unlink(workItem);
+    }
+    else if(!Processor()->RemoveJob(workItem))
+    {
+        // The backend is already working on it. Func::ThrowIfAborted checks for this between phases.
+        entryPoint->SetCodeGenAbandoned();
+        inFlight = true;
+    }
+
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    if(PHASE_TRACE(Js::JitCancellationPhase, functionBody))
+    {
+        char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+        Output::Print(_u("JitCancellation: %s (%s): %s work item for superseded entry point\n"),
+            functionBody->GetDisplayName(),
+            functionBody->GetDebugNumberSet(debugStringBuffer),
+            inFlight ? _u("abandoning in-flight") : _u("removing pending"));
+        Output::Flush();
+    }
+#endif
+
+    if(!inFlight)
+    {
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+        workItem->failureReason = Job::FailureReason::Aborted;
+#endif
+        // Cleans up the entry point and deletes the work item, the same as when the job is aborted while being processed
+        JobProcessed(workItem, false /*succeeded*/);
+    }
+}
+
 ExecutionMode NativeCodeGenerator::PrejitJitMode(Js::FunctionBody *const functionBody)
 {
     Assert(IS_PREJIT_ON() || functionBody->GetIsAsmjsMode());
@@ -3365,6 +3490,16 @@ void NativeCodeGenerator::AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem,
         }
     }
     Processor()->AddJob(codeGenWorkItem, prioritize);   // This one can throw (really unlikely though), OOM specifically.
+    if(prioritize)
+    {
+        Processor()->RankJob(this, codeGenWorkItem);
+    }
+    if(!PHASE_OFF1(Js::JitQueueRankingPhase))
+    {
+        // Move the new work item ahead of colder ones queued before it, along with any waiting work items whose function
+        // or loop got hotter since they were queued
+        Processor()->RankJobs(this);
+    }
     if(jitMode == ExecutionMode::FullJit)
     {
         QueuedFullJitWorkItem *const queuedFullJitWorkItem = codeGenWorkItem->EnsureQueuedFullJitWorkItem();
@@ -69,6 +69,7 @@ private:
     bool WasAddedToJobProcessor(JsUtil::Job *const job) const;
     bool ShouldProcessInForeground(const bool willWaitForJob, const unsigned int numJobsInQueue) const;
     void Prioritize(JsUtil::Job *const job, const bool forceAddJobToProcessor = false, void* function = nullptr);
+    bool ShouldProcessBefore(JsUtil::Job *const queuedJob, JsUtil::Job *const job) const;
     void PrioritizedButNotYetProcessed(JsUtil::Job *const job);
     void BeforeWaitForJob(Js::EntryPointInfo *const entryPoint) const;
     void AfterWaitForJob(Js::EntryPointInfo *const entryPoint) const;
@@ -78,6 +79,7 @@ private:
     JsUtil::Job *GetJobToProcessProactively();
     void AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem, bool prioritize, bool lock, void* function = nullptr);
     void RemoveProactiveJobs();
+    void AbandonSupersededCodeGen(Js::FunctionEntryPointInfo *const entryPoint);
     void UpdateJITState();
     static void LogCodeGenStart(CodeGenWorkItem * workItem, LARGE_INTEGER * start_time);
     static void LogCodeGenDone(CodeGenWorkItem * workItem, LARGE_INTEGER * start_time);
@@ -129,7 +131,14 @@ private:
 
     InProcCodeGenAllocators *CreateAllocators(PageAllocator *const pageAllocator)
     {
-        return HeapNew(InProcCodeGenAllocators, pageAllocator->GetAllocationPolicyManager(), scriptContext, scriptContext->GetThreadContext()->GetCodePageAllocators(), GetCurrentProcess());
+        AllocationPolicyManager *policyManager = pageAllocator->GetAllocationPolicyManager();
+        if (policyManager == nullptr && scriptContext->GetThreadContext()->IsJitThreadPoolShared())
+        {
+            // The threads of a shared job processor don't belong to any thread context. Charge the code to the one it's for,
+            // so that it counts toward that runtime's memory limit.
+            policyManager = scriptContext->GetThreadContext()->GetAllocationPolicyManager();
+        }
+        return HeapNew(InProcCodeGenAllocators, policyManager, scriptContext, scriptContext->GetThreadContext()->GetCodePageAllocators(), GetCurrentProcess());
     }
 
     InProcCodeGenAllocators *EnsureForegroundAllocators(PageAllocator * pageAllocator)
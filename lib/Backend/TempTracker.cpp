@@ -13,7 +13,10 @@
  *
  * ObjectTemp mark temp object allocations, run during backward pass so that it can provide
  * information to the globopt to install pre op bailout on implicit call while during stack
- * allocation objects.
+ * allocation objects. This is the only escape analysis the JIT does: a non-escaping
+ * object still gets a full object layout on the stack and its fields still go through
+ * memory. Bailout restores such objects by boxing the stack instance, not by building
+ * them from their field values, so scalar replacement would need that first.
  *
  * ObjectTempVerify runs a similar mark temp during deadstore in debug mode to assert
  * that globopt have install the pre op necessary and a marked temp def is still valid
@@ -55,6 +55,7 @@ NativeCodeGenerator * NewNativeCodeGenerator(Js::ScriptContext * nativeCodeGen);
 void DeleteNativeCodeGenerator(NativeCodeGenerator * nativeCodeGen);
 void CloseNativeCodeGenerator(NativeCodeGenerator* nativeCodeGen);
 bool IsClosedNativeCodeGenerator(NativeCodeGenerator* nativeCodeGen);
+uint GetQueuedJobCountNativeCodeGen(NativeCodeGenerator* nativeCodeGen);
 void SetProfileModeNativeCodeGen(NativeCodeGenerator *pNativeCodeGen, BOOL fSet);
 void UpdateNativeCodeGeneratorForDebugMode(NativeCodeGenerator* nativeCodeGen);
 
@@ -33,14 +33,14 @@ namespace JsUtil
     // Job
     // -------------------------------------------------------------------------------------------------------------------------
 
-    Job::Job(const bool isCritical) : manager(0), isCritical(isCritical)
+    Job::Job(const bool isCritical) : manager(0), isCritical(isCritical), isPrioritized(false)
 #if ENABLE_DEBUG_CONFIG_OPTIONS
         , failureReason(FailureReason::NotFailed)
 #endif
     {
     }
 
-    Job::Job(JobManager *const manager, const bool isCritical) : manager(manager), isCritical(isCritical)
+    Job::Job(JobManager *const manager, const bool isCritical) : manager(manager), isCritical(isCritical), isPrioritized(false)
 #if ENABLE_DEBUG_CONFIG_OPTIONS
         , failureReason(FailureReason::NotFailed)
 #endif
@@ -58,18 +58,29 @@ namespace JsUtil
         return isCritical;
     }
 
+    bool Job::IsPrioritized() const
+    {
+        return isPrioritized;
+    }
+
     // -------------------------------------------------------------------------------------------------------------------------
     // JobManager
     // -------------------------------------------------------------------------------------------------------------------------
 
     JobManager::JobManager(JobProcessor *const processor)
-        : processor(processor), numJobsAddedToProcessor(0), isWaitable(false)
+        : processor(processor), numJobsAddedToProcessor(0), isWaitable(false), lastServedTurn(0)
+#if DBG
+        , passedOverTurn(0), passedOverCount(0)
+#endif
     {
         Assert(processor);
     }
 
     JobManager::JobManager(JobProcessor *const processor, const bool isWaitable)
-        : processor(processor), numJobsAddedToProcessor(0), isWaitable(isWaitable)
+        : processor(processor), numJobsAddedToProcessor(0), isWaitable(isWaitable), lastServedTurn(0)
+#if DBG
+        , passedOverTurn(0), passedOverCount(0)
+#endif
     {
         Assert(processor);
     }
@@ -101,6 +112,11 @@ namespace JsUtil
     {
     }
 
+    bool JobManager::ShouldProcessBefore(JsUtil::Job *const queuedJob, JsUtil::Job *const job) const
+    {
+        return false;
+    }
+
     void JobManager::PrioritizedButNotYetProcessed(JsUtil::Job *const job) const
     {
     }
@@ -324,6 +340,7 @@ namespace JsUtil
         Assert(!IsClosed());
 
         jobs.Unlink(job);
+        job->isPrioritized = false;
         Assert(job->Manager()->numJobsAddedToProcessor != 0);
         --job->Manager()->numJobsAddedToProcessor;
         return true;
@@ -498,7 +515,9 @@ namespace JsUtil
             int processorCount = AutoSystemInfo::Data.GetNumberOfPhysicalProcessors();
             //There is 2 threads already in play, one UI (main) thread and a GC thread. So subtract 2 from processorCount to account for the same.
 
-            this->maxThreadCount = max(1, min(processorCount - 2, CONFIG_FLAG(MaxJitThreadCount)));
+            // A shared processor takes the place of every thread context's own jit threads, so it may use more of the machine.
+            const int maxCount = this->isShared ? CONFIG_FLAG(MaxSharedJitThreadCount) : CONFIG_FLAG(MaxJitThreadCount);
+            this->maxThreadCount = max(1, min(processorCount - 2, maxCount));
         }
     }
 
@@ -605,7 +624,7 @@ namespace JsUtil
         return;
     }
 
-    BackgroundJobProcessor::BackgroundJobProcessor(AllocationPolicyManager* policyManager, JsUtil::ThreadService *threadService, bool disableParallelThreads)
+    BackgroundJobProcessor::BackgroundJobProcessor(AllocationPolicyManager* policyManager, JsUtil::ThreadService *threadService, bool disableParallelThreads, bool isShared)
         : JobProcessor(true),
         jobReady(true),
         wakeAllBackgroundThreads(false),
@@ -613,7 +632,9 @@ namespace JsUtil
         threadId(GetCurrentThreadContextId()),
         threadService(threadService),
         threadCount(0),
-        maxThreadCount(0)
+        maxThreadCount(0),
+        isShared(isShared),
+        fairSchedulingTurn(0)
     {
         if (!threadService->HasCallback())
         {
@@ -810,6 +831,110 @@ namespace JsUtil
         return currentJob;
     }
 
+    Job * BackgroundJobProcessor::GetJobToProcess()
+    {
+        // This function is called from inside the lock
+
+        Job *job = jobs.Head();
+        if (!job || !isShared || IsClosed() || job->IsCritical() || PHASE_OFF1(Js::FairJitSchedulingPhase))
+        {
+            return TakeJob(job);
+        }
+
+        // A job the foreground asked for or is blocked on goes first, whoever it belongs to
+        bool isFairPick = !job->IsPrioritized();
+        JobManager *manager = job->Manager();
+        if (isFairPick && manager->isWaitable)
+        {
+            WaitableJobManager *const waitableManager = static_cast<WaitableJobManager *>(manager);
+            isFairPick = waitableManager->jobBeingWaitedUpon != job && !waitableManager->isWaitingForQueuedJobs;
+        }
+
+        // Otherwise the job managers take turns: the first job of the one that was served longest ago goes next, so that one
+        // thread context with a burst of work can't keep the others waiting however long its queue gets. A job is never taken
+        // from behind a critical or prioritized one.
+        if (isFairPick)
+        {
+            for (Job *candidate = job->Next();
+                candidate && manager->lastServedTurn != 0 && !candidate->IsCritical() && !candidate->IsPrioritized();
+                candidate = candidate->Next())
+            {
+                if (candidate->Manager()->lastServedTurn < manager->lastServedTurn)
+                {
+                    job = candidate;
+                    manager = candidate->Manager();
+                }
+            }
+        }
+
+#if DBG
+        VerifyFairJobSelection(job, isFairPick);
+#endif
+        manager->lastServedTurn = ++fairSchedulingTurn;
+        return TakeJob(job);
+    }
+
+#if DBG
+    void BackgroundJobProcessor::VerifyFairJobSelection(Job *const job, const bool isFairPick)
+    {
+        // Count how many picks in a row each job manager waiting in the fair part of the queue has been passed over. Once a
+        // job manager is served it goes behind every other one, so no waiting job manager can be passed over more times than
+        // there are other job managers. Jobs that go first regardless (see GetJobToProcess) don't count as passing anyone.
+        Assert(criticalSection.IsLocked());
+
+        const uint64 turn = fairSchedulingTurn + 1;
+        unsigned int managerCount = 0;
+        for (JobManager *manager = managers.Head(); manager; manager = manager->Next())
+        {
+            managerCount++;
+        }
+
+        for (Job *waiting = jobs.Head();
+            waiting && (waiting == jobs.Head() || (!waiting->IsCritical() && !waiting->IsPrioritized()));
+            waiting = waiting->Next())
+        {
+            JobManager *const manager = waiting->Manager();
+            if (manager == job->Manager() || manager->passedOverTurn == turn)
+            {
+                continue;
+            }
+
+            if (manager->passedOverTurn != turn - 1)
+            {
+                // It wasn't waiting at the last pick, so it starts over
+                manager->passedOverCount = 0;
+            }
+            manager->passedOverTurn = turn;
+            if (isFairPick)
+            {
+                manager->passedOverCount++;
+                AssertMsg(manager->passedOverCount < managerCount, "A job manager was passed over more than once by another one");
+            }
+        }
+
+        job->Manager()->passedOverTurn = turn;
+        job->Manager()->passedOverCount = 0;
+    }
+#endif
+
+    Job * BackgroundJobProcessor::TakeJob(Job *const job)
+    {
+        // This function is called from inside the lock
+
+        if (job)
+        {
+            jobs.Unlink(job);
+            job->isPrioritized = false;
+        }
+        return job;
+    }
+
+    unsigned int BackgroundJobProcessor::GetQueuedJobCount()
+    {
+        AutoCriticalSection lock(&criticalSection);
+        return numJobs;
+    }
+
     ParallelThreadData * BackgroundJobProcessor::GetThreadDataFromCurrentJob(Job* job)
     {
         Assert(criticalSection.IsLocked());
@@ -841,6 +966,13 @@ namespace JsUtil
             // Managers must remove themselves. Hence, Close does not remove managers. So, not asserting on !IsClosed().
 
             managers.Unlink(manager);
+#if DBG
+            // The manager may have passed over the ones still waiting, which VerifyFairJobSelection no longer counts on
+            for (JobManager *remainingManager = managers.Head(); remainingManager; remainingManager = remainingManager->Next())
+            {
+                remainingManager->passedOverCount = 0;
+            }
+#endif
             if(manager->numJobsAddedToProcessor == 0)
             {
                 Assert(!GetCurrentJobOfManager(manager));
@@ -1042,7 +1174,7 @@ namespace JsUtil
             criticalSection.Enter();
             while (!IsClosed() || (jobs.Head() && jobs.Head()->IsCritical()))
             {
-                Job *job = jobs.UnlinkFromBeginning();
+                Job *job = GetJobToProcess();
 
                 if(!job)
                 {
@@ -34,6 +34,10 @@ namespace JsUtil
     {
         friend SingleJobManager;
         friend WaitableSingleJobManager;
+        friend JobProcessor;
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
+        friend BackgroundJobProcessor;
+#endif
 
     private:
         JobManager *manager;
@@ -44,6 +48,10 @@ namespace JsUtil
         // JobManager::JobProcessed(succeeded = false).
         const bool isCritical;
 
+        // Set when the job was queued by PrioritizeJob and not yet handed to a thread. A shared job processor that reorders
+        // jobs for fairness does not move other jobs ahead of it.
+        bool isPrioritized;
+
     private:
         Job(const bool isCritical = false);
     public:
@@ -65,6 +73,7 @@ namespace JsUtil
     public:
         JobManager *Manager() const;
         bool IsCritical() const;
+        bool IsPrioritized() const;
     };
 
     // -------------------------------------------------------------------------------------------------------------------------
@@ -87,6 +96,15 @@ namespace JsUtil
         JobProcessor *const processor;
         unsigned int numJobsAddedToProcessor;
 
+        // The turn at which a shared background job processor last took one of this job manager's jobs (0 if never). Job
+        // managers take turns in the order they were last served (see BackgroundJobProcessor::GetJobToProcess).
+        uint64 lastServedTurn;
+#if DBG
+        // Picks this job manager has been passed over in a row while waiting (see BackgroundJobProcessor::VerifyFairJobSelection)
+        uint64 passedOverTurn;
+        unsigned int passedOverCount;
+#endif
+
         // Only job managers derived from WaitableJobManager support waiting for a job or the job manager's queued jobs
         const bool isWaitable;
 
@@ -98,6 +116,10 @@ namespace JsUtil
     public:
         JobProcessor *Processor() const;
 
+        // Jobs added to the job processor that haven't been processed yet, including any that are being processed. Read
+        // without the lock, so it's only a snapshot.
+        unsigned int NumberOfJobsAddedToProcessor() const { return numJobsAddedToProcessor; }
+
     protected:
         // Called by the job processor (outside the lock) to process a job. A job manager may choose to return false to indicate
         // a failure. Throwing OutOfMemoryException or OperationAbortedException also indicate a processing failure.
@@ -164,6 +186,13 @@ namespace JsUtil
         //     forceAddToJobProcessor = true since it needs to wait for the job, and the job manager should ensure to add the
         //     job to the job processor during the Prioritize call in that case.
         //
+        // bool ShouldProcessBefore(JsUtil::Job *const queuedJob, JsUtil::Job *const job) const;
+        //     Called in response to PrioritizeJob (inside the lock) or RankJob, to find where in the queue to put a job that
+        //     is to be prioritized. The job is placed behind the jobs at the front of the queue for which this returns true.
+        //     The job manager is asked about the jobs of other job managers too, and should generally return false for those.
+        //     Also called by RankJobs with two of the job manager's own queued jobs, to find whether the later one should now
+        //     be processed before the earlier one.
+        //
         // void PrioritizedButNotYetProcessed(JsUtil::Job *const job) const;
         //     Called in response to PrioritizeJob (inside the lock), if the job was not yet processed. May be useful for
         //     tracking how often the job manager asks to prioritize jobs and the jobs are not yet processed. Although the
@@ -181,6 +210,7 @@ namespace JsUtil
         Job *GetJobToProcessProactively();
         bool ShouldProcessInForeground(const bool willWaitForJob, const unsigned int numJobsInQueue) const;
         void Prioritize(JsUtil::Job *const job, const bool forceAddJobToProcessor = false, void* function = nullptr) const;
+        bool ShouldProcessBefore(JsUtil::Job *const queuedJob, JsUtil::Job *const job) const;
         void PrioritizedButNotYetProcessed(JsUtil::Job *const job) const;
         void BeforeWaitForJob(bool) const;
         void AfterWaitForJob(bool) const;
@@ -336,6 +366,15 @@ namespace JsUtil
         // Must be called from inside the lock
         virtual bool RemoveJob(Job *const job);
 
+        // Moves a job that is waiting in the queue behind the jobs at the front of the queue that the job manager wants to be
+        // processed first (see JobManager::ShouldProcessBefore). Must be called from inside the lock.
+        template<class TJobManager> void RankJob(TJobManager *const manager, Job *const job);
+
+        // Moves each of the job manager's waiting jobs ahead of the manager's jobs right in front of it that it should now be
+        // processed before (see JobManager::ShouldProcessBefore), keeping the order of jobs that rank the same. Jobs of other
+        // job managers and prioritized jobs keep their place. Must be called from inside the lock.
+        template<class TJobManager> void RankJobs(TJobManager *const manager);
+
         template<class TJobManager, class TJobHolder>
         void AddJobAndProcessProactively(TJobManager *const jobManager, const TJobHolder holder);
 
@@ -457,12 +496,18 @@ namespace JsUtil
         unsigned int maxThreadCount;
         ParallelThreadData **parallelThreadData;
 
+        // A shared job processor serves the job managers of every thread context in the process. Its thread count is sized to
+        // the machine rather than to one thread context, and jobs are handed out so that one busy job manager doesn't starve
+        // the others.
+        const bool isShared;
+        uint64 fairSchedulingTurn;
+
 #if DBG_DUMP
         static  char16 const * const  DebugThreadNames[16];
 #endif
 
     public:
-        BackgroundJobProcessor(AllocationPolicyManager* policyManager, ThreadService *threadService, bool disableParallelThreads);
+        BackgroundJobProcessor(AllocationPolicyManager* policyManager, ThreadService *threadService, bool disableParallelThreads, bool isShared);
         ~BackgroundJobProcessor();
 
 
@@ -476,6 +521,11 @@ namespace JsUtil
         bool AreAllThreadsWaitingForJobs();
         uint NumberOfThreadsWaitingForJobs ();
         Job* GetCurrentJobOfManager(JobManager *const manager);
+        Job* GetJobToProcess();
+#if DBG
+        void VerifyFairJobSelection(Job *const job, const bool isFairPick);
+#endif
+        Job* TakeJob(Job *const job);
         ParallelThreadData * GetThreadDataFromCurrentJob(Job* job);
 
         void InitializeThreadCount();
@@ -510,6 +560,10 @@ namespace JsUtil
         bool Process(Job *const job, ParallelThreadData *threadData);
         bool IsBeingProcessed(Job *job);
 
+        bool IsShared() const { return isShared; }
+        unsigned int GetThreadCount() const { return threadCount; }
+        unsigned int GetQueuedJobCount();
+
         CriticalSection * GetCriticalSection() { return &criticalSection; }
 
         //Iterates each background thread, callback returns true when it needs to terminate the iteration.
@@ -46,6 +46,82 @@ namespace JsUtil
         }
     }
 
+    template<class TJobManager>
+    void JobProcessor::RankJob(TJobManager *const manager, Job *const job)
+    {
+        // This function is called from inside the lock
+
+        TemplateParameter::SameOrDerivedFrom<TJobManager, JobManager> unused;
+        Assert(manager);
+        Assert(job);
+        Assert(job->Manager() == manager);
+        Assert(jobs.Contains(job));
+
+        jobs.Unlink(job);
+
+        Job *previousJob = nullptr;
+        for(Job *queuedJob = jobs.Head(); queuedJob && manager->ShouldProcessBefore(queuedJob, job); queuedJob = queuedJob->Next())
+        {
+            previousJob = queuedJob;
+        }
+
+        if(previousJob)
+            jobs.LinkAfter(job, previousJob);
+        else
+            jobs.LinkToBeginning(job);
+    }
+
+    template<class TJobManager>
+    void JobProcessor::RankJobs(TJobManager *const manager)
+    {
+        // This function is called from inside the lock
+
+        TemplateParameter::SameOrDerivedFrom<TJobManager, JobManager> unused;
+        Assert(manager);
+
+        // An insertion sort within each run of the manager's jobs. The queue is usually ranked already except for the jobs
+        // that got hotter since they were queued, so this is about a single pass.
+        Job *nextJob;
+        for(Job *job = jobs.Head(); job; job = nextJob)
+        {
+            nextJob = job->Next();
+            if(job->Manager() != manager || job->IsPrioritized())
+                continue;
+
+            Job *previousJob = job->Previous();
+            while(previousJob &&
+                previousJob->Manager() == manager &&
+                !previousJob->IsPrioritized() &&
+                manager->ShouldProcessBefore(job, previousJob))
+            {
+                previousJob = previousJob->Previous();
+            }
+
+            if(previousJob == job->Previous())
+                continue;
+
+            jobs.Unlink(job);
+            if(previousJob)
+                jobs.LinkAfter(job, previousJob);
+            else
+                jobs.LinkToBeginning(job);
+        }
+
+#if DBG
+        for(Job *job = jobs.Head(); job; job = job->Next())
+        {
+            Job *const previousJob = job->Previous();
+            Assert(
+                !previousJob ||
+                job->Manager() != manager ||
+                previousJob->Manager() != manager ||
+                job->IsPrioritized() ||
+                previousJob->IsPrioritized() ||
+                !manager->ShouldProcessBefore(job, previousJob));
+        }
+#endif
+    }
+
     template<class TJobManager, class TJobHolder>
     bool JobProcessor::PrioritizeJob(TJobManager *const manager, const TJobHolder holder, void* function)
     {
@@ -347,6 +423,7 @@ namespace JsUtil
             {
                 // The job wasn't added for processing, so ask the manager to prioritize it
                 manager->Prioritize(job, false, function);
+                job->isPrioritized = manager->WasAddedToJobProcessor(job);
                 manager->PrioritizedButNotYetProcessed(job);
                 return false;
             }
@@ -363,7 +440,8 @@ namespace JsUtil
             bool forcedInThread = (threadService->HasCallback() && this->parallelThreadData[0]->isWaitingForJobs);
             if (!forcedInThread && !manager->ShouldProcessInForeground(false, numJobs))
             {
-                jobs.MoveToBeginning(job);
+                RankJob(manager, job);
+                job->isPrioritized = true;
                 manager->PrioritizedButNotYetProcessed(job);
                 return false;
             }
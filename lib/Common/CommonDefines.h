@@ -131,12 +131,20 @@
 // xplat-todo: re-enable this in the future
 // These are disabled because these GC features depend on hardware
 // write-watch support that the Windows Memory Manager provides.
+// The RecyclerWriteBarrierManager card table can't stand in for it yet:
+// only objects allocated with RecyclerNewWithBarrier* set cards, so a
+// rescan driven by it would miss writes to every other object. Partial
+// collect has the same problem: it only rescans the pages found dirty.
+// Concurrent sweep doesn't need write-watch, but it runs on the concurrent
+// GC thread and shares its pending block lists, so it goes with it.
 #ifdef _WIN32
 #define SYSINFO_IMAGE_BASE_AVAILABLE 1
 #define ENABLE_CONCURRENT_GC 1
 #define ENABLE_PARTIAL_GC 1
 #define ENABLE_BACKGROUND_PAGE_ZEROING 1
 #define ENABLE_BACKGROUND_PAGE_FREEING 1
+#define ENABLE_LAZY_PAGE_ZEROING 0
+#define ENABLE_HUGE_PAGE_SEGMENTS 0                 // MEM_LARGE_PAGES needs SeLockMemoryPrivilege and can't be decommitted
 #define ENABLE_RECYCLER_TYPE_TRACKING 1
 #define ENABLE_JS_ETW                               // ETW support
 #else
@@ -145,6 +153,8 @@
 #define ENABLE_PARTIAL_GC 0
 #define ENABLE_BACKGROUND_PAGE_ZEROING 0
 #define ENABLE_BACKGROUND_PAGE_FREEING 0
+#define ENABLE_LAZY_PAGE_ZEROING 1                  // No background zeroing thread: let the OS zero large freed runs on next touch
+#define ENABLE_HUGE_PAGE_SEGMENTS 1                 // Opt-in 2MB aligned, MADV_HUGEPAGE advised segments (PAL MEM_LARGE_PAGES)
 #define ENABLE_RECYCLER_TYPE_TRACKING 0
 #endif
 
@@ -152,6 +162,10 @@
 #error "Background page zeroing can't be turned on if freeing pages in the background is disabled"
 #endif
 
+#if ENABLE_BACKGROUND_PAGE_ZEROING && ENABLE_LAZY_PAGE_ZEROING
+#error "Lazy page zeroing is the fallback for platforms without background page zeroing"
+#endif
+
 #define BUCKETIZE_MEDIUM_ALLOCATIONS 1              // *** TODO: Won't build if disabled currently
 #define SMALLBLOCK_MEDIUM_ALLOC 1                   // *** TODO: Won't build if disabled currently
 #define LARGEHEAPBLOCK_ENCODING 1                   // Large heap block metadata encoding
@@ -194,6 +208,10 @@
 #endif
 #endif
 
+#if ENABLE_PROFILE_INFO
+#define DYNAMIC_PROFILE_SERIALIZATION   // Host driven save and load of dynamic profile data (JsSerializeScriptProfile)
+#endif
+
 // Other features
 // #define CHAKRA_CORE_DOWN_COMPAT 1
 
@@ -32,6 +32,9 @@ PHASE(All)
         PHASE(OptimizeBlockScope)
     PHASE(Delay)
         PHASE(Speculation)
+        PHASE(FairJitScheduling)
+        PHASE(JitQueueRanking)
+        PHASE(JitCancellation)
         PHASE(GatherCodeGenData)
     PHASE(WasmBytecode)
         PHASE(WasmParser)
@@ -167,6 +170,7 @@ PHASE(All)
                     PHASE(FixedFieldGuardCheck)
                     PHASE(FixedNewObj)
                         PHASE(JitAllocNewObj)
+                            PHASE(JitAllocFreeList)
                     PHASE(FixedCtorInlining)
                     PHASE(FixedCtorCalls)
                     PHASE(FixedScriptMethodInlining)
@@ -222,6 +226,7 @@ PHASE(All)
                 PHASE(RegionUseCount)
                 PHASE(RegHoistLoads)
                 PHASE(ClearRegLoopExit)
+                PHASE(FastRegAlloc)
         PHASE(Peeps)
         PHASE(Layout)
         PHASE(EHBailoutPatchUp)
@@ -265,6 +270,7 @@ PHASE(All)
                 PHASE(BackgroundFinishMark)
             PHASE(ConcurrentPartialCollect)
             PHASE(ParallelMark)
+                PHASE(ParallelMarkWorkSharing)
             PHASE(PartialCollect)
                 PHASE(ResetMarks)
                 PHASE(ResetWriteWatch)
@@ -343,6 +349,7 @@ PHASE(All)
         PHASE(ConsoleScope)
         PHASE(ScriptProfiler)
         PHASE(JSON)
+            PHASE(JSONStringifyFastPath)
         PHASE(RegexResultNotUsed)
         PHASE(Error)
         PHASE(PropertyRecord)
@@ -453,6 +460,7 @@ PHASE(All)
 
 #define DEFAULT_CONFIG_MaxJitThreadCount        (2)
 #define DEFAULT_CONFIG_ForceMaxJitThreadCount   (false)
+#define DEFAULT_CONFIG_MaxSharedJitThreadCount  (8)
 
 #ifdef RECYCLER_PAGE_HEAP
 #define DEFAULT_CONFIG_PageHeap             ((Js::Number) PageHeapMode::PageHeapModeOff)
@@ -473,6 +481,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_ForceStrictMode      (false)
 #define DEFAULT_CONFIG_EnableEvalMapCleanup (true)
 #define DEFAULT_CONFIG_ExpirableCollectionGCCount (5)  // Number of GCs during which entry point profiling occurs
+#define DEFAULT_CONFIG_MaxParallelMarkThreads (4)      // Upper bound; the recycler has four mark contexts
 #define DEFAULT_CONFIG_ExpirableCollectionTriggerThreshold (50)  // Threshold at which Entry Point Collection is triggered
 #define DEFAULT_CONFIG_RegexTracing         (false)
 #define DEFAULT_CONFIG_RegexProfile         (false)
@@ -594,6 +603,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_MaxJITFunctionBytecodeSize (120000)
 
 #define DEFAULT_CONFIG_JitQueueThreshold      (6)
+#define DEFAULT_CONFIG_FastRegAllocSymCount   (20000)
 
 #define DEFAULT_CONFIG_FullJitRequeueThreshold (25)     // Minimum number of times a function needs to be executed before it is re-added to the jit queue
 
@@ -717,6 +727,17 @@ PHASE(All)
 #define DEFAULT_CONFIG_ZeroMemoryWithNonTemporalStore (true)
 #endif
 
+#if ENABLE_LAZY_PAGE_ZEROING
+#define DEFAULT_CONFIG_LazyZeroPageThreshold (16)      // 64KB with 4K pages; smaller runs are cheaper to memset
+#endif
+#if ENABLE_HUGE_PAGE_SEGMENTS
+#define DEFAULT_CONFIG_HugePageSegments     (false)
+#endif
+#define DEFAULT_CONFIG_NumaAffinity         (false)
+#define DEFAULT_CONFIG_NumaNode             (-1)
+#define DEFAULT_CONFIG_SharedSegmentPool    (false)
+#define DEFAULT_CONFIG_SharedSegmentPoolMaxCount (16)  // Pooled segments are decommitted; this bounds the address space kept for reuse
+
 #define TraceLevel_Error        (1)
 #define TraceLevel_Warning      (2)
 #define TraceLevel_Info         (3)
@@ -925,6 +946,7 @@ FLAGNR(String,  DynamicProfileMutator , "Type of local, temp, return, param, loo
 #endif
 FLAGNR(Boolean, ExecuteByteCodeBufferReturnsInvalidByteCode, "Serialized byte code execution always returns SCRIPT_E_INVALID_BYTECODE", false)
 FLAGR(Number, ExpirableCollectionGCCount, "Number of GCs during which Expirable object profiling occurs", DEFAULT_CONFIG_ExpirableCollectionGCCount)
+FLAGR(Number, MaxParallelMarkThreads, "Maximum number of threads, including the calling thread, used for parallel mark (1 to 4)", DEFAULT_CONFIG_MaxParallelMarkThreads)
 FLAGR (Number,  ExpirableCollectionTriggerThreshold, "Threshold at which Expirable Object Collection is triggered (In Percentage)", DEFAULT_CONFIG_ExpirableCollectionTriggerThreshold)
 FLAGR(Boolean, SkipSplitOnNoResult, "If the result of Regex split isn't used, skip executing the regex. (Perf optimization)", DEFAULT_CONFIG_SkipSplitWhenResultIgnored)
 #ifdef TEST_ETW_EVENTS
@@ -1125,6 +1147,7 @@ FLAGNR(Number,  InlineThresholdAdjustCountInSmallFunction       , "Adjustment in
 FLAGNR(String,  Interpret             , "List of functions to interpret", nullptr)
 FLAGNR(Phases,  Instrument            , "Instrument the generated code from the given phase", )
 FLAGNR(Number,  JitQueueThreshold     , "Max number of work items/script context in the jit queue", DEFAULT_CONFIG_JitQueueThreshold)
+FLAGNR(Number,  FastRegAllocSymCount  , "Number of syms from which a function's registers are allocated in the fast mode of linear scan, with -on:FastRegAlloc", DEFAULT_CONFIG_FastRegAllocSymCount)
 #ifdef LEAK_REPORT
 FLAGNR(String,  LeakReport            , "File name for the leak report", nullptr)
 #endif
@@ -1157,6 +1180,7 @@ FLAGNR(Number,  LoopBodySizeThresholdToDisableOpts, "Minimum bytecode size of a
 
 FLAGNR(Number,  MaxJitThreadCount     , "Number of maximum allowed parallel jit threads (actual number is factor of number of processors and other heuristics)", DEFAULT_CONFIG_MaxJitThreadCount)
 FLAGNR(Boolean, ForceMaxJitThreadCount, "Force the number of parallel jit threads as specified by MaxJitThreadCount flag (creation guaranteed)", DEFAULT_CONFIG_ForceMaxJitThreadCount)
+FLAGNR(Number,  MaxSharedJitThreadCount, "Number of maximum allowed jit threads in the pool shared by all runtimes in the process", DEFAULT_CONFIG_MaxSharedJitThreadCount)
 
 FLAGNR(Number,  MinInterpretCount     , "Minimum number of times a function must be interpreted", 0)
 FLAGNR(Number,  MinSimpleJitRunCount  , "Minimum number of times a function must be run in simple jit", 0)
@@ -1441,6 +1465,16 @@ FLAGNR(Number,  MinBackgroundRepeatMarkRescanBytes, "Minimum number of bytes res
 #if defined(_M_IX86) || defined(_M_X64)
 FLAGNR(Boolean, ZeroMemoryWithNonTemporalStore, "Zero free memory with non-temporal stores to avoid evicting other content from processor cache", DEFAULT_CONFIG_ZeroMemoryWithNonTemporalStore)
 #endif
+#if ENABLE_LAZY_PAGE_ZEROING
+FLAGNR(Number,  LazyZeroPageThreshold, "Minimum number of freed pages to hand back to the OS for lazy zeroing instead of zeroing them in place (0 to disable)", DEFAULT_CONFIG_LazyZeroPageThreshold)
+#endif
+FLAGNR(Boolean, SharedSegmentPool     , "Release the segments of every runtime to a pool shared by the runtimes in the process, and take new segments from it", DEFAULT_CONFIG_SharedSegmentPool)
+FLAGNR(Number,  SharedSegmentPoolMaxCount, "Maximum number of released page segments kept in the shared pool for reuse by any runtime in the process (0 to disable)", DEFAULT_CONFIG_SharedSegmentPoolMaxCount)
+FLAGNR(Boolean, NumaAffinity          , "Bind the recycler's segments to the NUMA node of the thread that creates it", DEFAULT_CONFIG_NumaAffinity)
+FLAGNR(Number,  NumaNode              , "With NumaAffinity, bind the recycler's segments to this node instead, even on a single node system (-1 for the thread's node)", DEFAULT_CONFIG_NumaNode)
+#if ENABLE_HUGE_PAGE_SEGMENTS
+FLAGNR(Boolean, HugePageSegments      , "Reserve recycler large object and code page allocator segments of 2MB or more on 2MB boundaries and back them with transparent huge pages", DEFAULT_CONFIG_HugePageSegments)
+#endif
 
 // recycler memory restrict test flags
 FLAGNR(Number,  MaxMarkStackPageCount , "Restrict recycler mark stack size (in pages)", -1)
@@ -95,6 +95,10 @@ AutoSystemInfo::Initialize()
 #endif
 
     InitPhysicalProcessorCount();
+    if (!GetNumaHighestNodeNumber(&highestNumaNodeNumber))
+    {
+        highestNumaNodeNumber = 0;
+    }
 #if DBG
     initialized = true;
 #endif
@@ -120,6 +124,26 @@ AutoSystemInfo::Initialize()
 }
 
 
+// Node of the processor the calling thread is currently running on, or
+// NUMA_NO_PREFERRED_NODE on single node systems or if it can't be determined.
+DWORD
+AutoSystemInfo::GetCurrentNumaNode() const
+{
+    if (!IsNumaSystem())
+    {
+        return NUMA_NO_PREFERRED_NODE;
+    }
+
+    DWORD processor = ::GetCurrentProcessorNumber();
+    UCHAR node;
+    if (processor > UCHAR_MAX || !::GetNumaProcessorNode((UCHAR)processor, &node) || node == UCHAR_MAX)
+    {
+        return NUMA_NO_PREFERRED_NODE;
+    }
+
+    return node;
+}
+
 bool
 AutoSystemInfo::InitPhysicalProcessorCount()
 {
@@ -441,6 +465,16 @@ HRESULT AutoSystemInfo::GetJscriptFileVersion(DWORD* majorVersion, DWORD* minorV
         *minorVersion = AutoSystemInfo::Data.minorVersion;
         hr = S_OK;
     }
+#ifndef _WIN32
+    else
+    {
+        // There is no version resource to read (see GetVersionInfo), so INVALID_VERSION is the cached
+        // result of a successful lookup, not of a failed one. The build hashes identify the binary.
+        *majorVersion = INVALID_VERSION;
+        *minorVersion = INVALID_VERSION;
+        hr = NOERROR;
+    }
+#endif
 
     if (buildDateHash)
     {
@@ -38,6 +38,8 @@ public:
     void SetAvailableCommit(ULONG64 commit);
     DWORD GetNumberOfLogicalProcessors() const { return this->dwNumberOfProcessors; }
     DWORD GetNumberOfPhysicalProcessors() const { return this->dwNumberOfPhysicalProcessors; }
+    bool IsNumaSystem() const { return this->highestNumaNodeNumber != 0; }
+    DWORD GetCurrentNumaNode() const;
 
 #if SYSINFO_IMAGE_BASE_AVAILABLE
     UINT_PTR GetChakraBaseAddr() const;
@@ -89,6 +91,7 @@ private:
     bool armDivAvailable;
 #endif
     DWORD dwNumberOfPhysicalProcessors;
+    ULONG highestNumaNodeNumber;
 
     bool disableDebugScopeCapture;
 #if DBG
@@ -15,6 +15,51 @@ private:
     static const size_t EntriesPerChunk = (AutoSystemInfo::PageSize - sizeof(Chunk)) / sizeof(T);
 
 public:
+    // Full chunks handed between stacks that are processed in parallel.
+    // A stack that runs dry waits here for a chunk from one that still has work,
+    // instead of idling until the slowest stack is done.
+    // This lives outside the stacks, since those may be copied while they are processed.
+    class SharedChunkList
+    {
+    public:
+        SharedChunkList() : chunks(nullptr), activeCount(0), waitingCount(0), chunkAvailableEvent(nullptr) {}
+        ~SharedChunkList()
+        {
+            if (chunkAvailableEvent != nullptr)
+            {
+                CloseHandle(chunkAvailableEvent);
+            }
+        }
+
+        // Waiters sleep on an event set whenever a chunk is shared or the last active stack runs dry
+        bool EnsureEvent()
+        {
+            if (chunkAvailableEvent == nullptr)
+            {
+                chunkAvailableEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+            }
+            return chunkAvailableEvent != nullptr;
+        }
+
+        bool HasWaiters() const { return waitingCount != 0; }
+        bool IsEmpty() const { return chunks == nullptr; }
+        void Reset()
+        {
+            Assert(IsEmpty());
+            activeCount = 0;
+            waitingCount = 0;
+        }
+
+    private:
+        friend class PageStack<T>;
+
+        CriticalSection cs;
+        Chunk * chunks;
+        uint activeCount;
+        volatile uint waitingCount;
+        HANDLE chunkAvailableEvent;
+    };
+
     PageStack(PagePool * pagePool);
     ~PageStack();
 
@@ -26,6 +71,10 @@ public:
 
     uint Split(uint targetCount, __in_ecount(targetCount) PageStack<T> ** targetStacks);
 
+    void SetSharedChunkList(SharedChunkList * list) { this->sharedChunkList = list; }
+    void JoinSharedChunkList();
+    bool TakeSharedChunk();
+
     void Abort();
     void Release();
 
@@ -49,6 +98,7 @@ public:
 private:
     Chunk * CreateChunk();
     void FreeChunk(Chunk * chunk);
+    void ShareChunk(Chunk * chunk);
 
 private:
     T * nextEntry;
@@ -56,6 +106,7 @@ private:
     T * chunkEnd;
     Chunk * currentChunk;
     PagePool * pagePool;
+    SharedChunkList * sharedChunkList;
     bool usesReservedPages;
 
 #if DBG
@@ -124,6 +175,12 @@ bool PageStack<T>::Push(T item)
         chunkStart = currentChunk->entries;
         chunkEnd = &currentChunk->entries[EntriesPerChunk];
         nextEntry = chunkStart;
+
+        if (sharedChunkList != nullptr && sharedChunkList->HasWaiters())
+        {
+            // Someone ran out of work; give them the chunk we just filled.
+            ShareChunk(currentChunk->nextChunk);
+        }
     }
 
     Assert(nextEntry >= chunkStart && nextEntry < chunkEnd);
@@ -143,6 +200,7 @@ bool PageStack<T>::Push(T item)
 template <typename T>
 PageStack<T>::PageStack(PagePool * pagePool) :
     pagePool(pagePool),
+    sharedChunkList(nullptr),
     currentChunk(nullptr),
     nextEntry(nullptr),
     chunkStart(nullptr),
@@ -353,6 +411,106 @@ uint PageStack<T>::Split(uint targetCount, __in_ecount(targetCount) PageStack<T>
 }
 
 
+template <typename T>
+void PageStack<T>::ShareChunk(Chunk * chunk)
+{
+    Assert(chunk == currentChunk->nextChunk);
+
+    AutoCriticalSection autocs(&sharedChunkList->cs);
+
+    // The waiter may have given up since we checked.
+    if (!sharedChunkList->HasWaiters())
+    {
+        return;
+    }
+
+    currentChunk->nextChunk = chunk->nextChunk;
+    chunk->nextChunk = sharedChunkList->chunks;
+    sharedChunkList->chunks = chunk;
+    SetEvent(sharedChunkList->chunkAvailableEvent);
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    this->pageCount--;
+#endif
+#if DBG
+    this->count -= EntriesPerChunk;
+#endif
+}
+
+
+template <typename T>
+void PageStack<T>::JoinSharedChunkList()
+{
+    if (sharedChunkList == nullptr)
+    {
+        return;
+    }
+
+    AutoCriticalSection autocs(&sharedChunkList->cs);
+    sharedChunkList->activeCount++;
+}
+
+
+template <typename T>
+bool PageStack<T>::TakeSharedChunk()
+{
+    // Wait for a chunk from one of the other stacks sharing the list.
+    // Returns false once the list is empty and no stack is left that could add to it.
+
+    Assert(IsEmpty());
+    Assert(currentChunk != nullptr);
+
+    if (sharedChunkList == nullptr)
+    {
+        return false;
+    }
+
+    AutoCriticalSection autocs(&sharedChunkList->cs);
+    Assert(sharedChunkList->activeCount != 0);
+    sharedChunkList->activeCount--;
+    sharedChunkList->waitingCount++;
+
+    while (sharedChunkList->chunks == nullptr)
+    {
+        if (sharedChunkList->activeCount == 0)
+        {
+            // Nobody is left to share work; wake the other waiters so they see that too.
+            sharedChunkList->waitingCount--;
+            SetEvent(sharedChunkList->chunkAvailableEvent);
+            return false;
+        }
+
+        // The event is only set and reset under the lock, so a chunk shared after we leave it still wakes us.
+        ResetEvent(sharedChunkList->chunkAvailableEvent);
+        sharedChunkList->cs.Leave();
+        WaitForSingleObject(sharedChunkList->chunkAvailableEvent, INFINITE);
+        sharedChunkList->cs.Enter();
+    }
+
+    Chunk * chunk = sharedChunkList->chunks;
+    sharedChunkList->chunks = chunk->nextChunk;
+    sharedChunkList->waitingCount--;
+    sharedChunkList->activeCount++;
+
+    // Our own chunk is empty; swap it for the full one.
+    FreeChunk(currentChunk);
+    chunk->nextChunk = nullptr;
+    currentChunk = chunk;
+    chunkStart = chunk->entries;
+    chunkEnd = &chunk->entries[EntriesPerChunk];
+    nextEntry = chunkEnd;
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    this->pageCount++;
+#endif
+#if DBG
+    this->count = EntriesPerChunk;
+#endif
+
+    return true;
+}
+
+
 template <typename T>
 void PageStack<T>::Abort()
 {
@@ -28,6 +28,7 @@ typedef bool (__stdcall * PageAllocatorMemoryAllocationCallback)(__in LPVOID con
 private:
     size_t memoryLimit;
     size_t currentMemory;
+    size_t lazyZeroedMemory;
     bool supportConcurrency;
     CriticalSection cs;
     void * context;
@@ -37,6 +38,7 @@ public:
     AllocationPolicyManager(bool needConcurrencySupport) :
         memoryLimit((size_t)-1),
         currentMemory(0),
+        lazyZeroedMemory(0),
         supportConcurrency(needConcurrencySupport),
         context(NULL),
         memoryAllocationCallback(NULL)
@@ -53,6 +55,13 @@ public:
         return currentMemory;
     }
 
+    // Total size of the freed page runs whose zeroing was left to the OS (see
+    // PageAllocatorBase::TryLazyZeroPages) instead of done on the freeing thread.
+    size_t GetLazyZeroedMemory()
+    {
+        return lazyZeroedMemory;
+    }
+
     size_t GetLimit()
     {
         return memoryLimit;
@@ -104,6 +113,19 @@ public:
         }
     }
 
+    void ReportLazyZero(size_t byteCount)
+    {
+        if (supportConcurrency)
+        {
+            AutoCriticalSection auto_cs(&cs);
+            lazyZeroedMemory += byteCount;
+        }
+        else
+        {
+            lazyZeroedMemory += byteCount;
+        }
+    }
+
     void SetMemoryAllocationCallback(LPVOID newContext, PageAllocatorMemoryAllocationCallback callback)
     {
         this->memoryAllocationCallback = callback;
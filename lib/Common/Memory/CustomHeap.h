@@ -171,6 +171,21 @@ public:
         return this->pageAllocator.IsAddressFromAllocator(address);
     }
 
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    void EnableHugePageSegments()
+    {
+        AutoCriticalSection autoLock(&this->cs);
+        // The pre-reserved region is carved up by its own allocator and is left alone
+        this->pageAllocator.EnableHugePageSegments();
+    }
+
+    size_t GetHugePageBackedBytes()
+    {
+        AutoCriticalSection autoLock(&this->cs);
+        return this->pageAllocator.GetHugePageBackedBytes();
+    }
+#endif
+
     char * Alloc(size_t * pages, void ** segment, bool canAllocInPreReservedHeapPageSegment, bool isAnyJittedCode, bool * isAllJITCodeInPreReservedRegion)
     {
         Assert(this->cs.IsLocked());
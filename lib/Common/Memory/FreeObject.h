@@ -21,6 +21,9 @@ public:
         taggedNext = ((INT_PTR)next) | TaggedBit;
     }
     void ZeroNext() { taggedNext = 0; }
+
+    // For JIT
+    static INT_PTR GetTaggedBit() { return TaggedBit; }
 #ifdef RECYCLER_MEMORY_VERIFY
 #pragma warning(suppress:4310)
     void DebugFillNext() { taggedNext = (INT_PTR)0xCACACACACACACACA; }
@@ -54,6 +54,13 @@ struct HeapBucketStats
 #define RECYCLER_TRACK_NATIVE_ALLOCATED_OBJECTS
 #endif
 
+// Native code can pop objects off a swept block's free list. Builds that keep per-object
+// free bits or fill patterns in the allocation helper always go through the helper instead,
+// so only release builds have this path (see the exclude_chk run of test/Optimizer/jitAllocFreeList.js).
+#if !DBG && !defined(RECYCLER_STATS) && !defined(RECYCLER_MEMORY_VERIFY)
+#define RECYCLER_NATIVE_FREE_LIST_ALLOC
+#endif
+
 #ifdef RECYCLER_SLOW_CHECK_ENABLED
 #define RECYCLER_SLOW_CHECK(x) x
 #define RECYCLER_SLOW_CHECK_IF(cond, x) if (cond) { x; }
@@ -19,6 +19,7 @@ private:
 
 public:
     static const int MarkCandidateSize = sizeof(MarkCandidate);
+    typedef PageStack<MarkCandidate>::SharedChunkList SharedMarkStackChunkList;
 
     MarkContext(Recycler * recycler, PagePool * pagePool);
     ~MarkContext();
@@ -48,6 +49,7 @@ public:
     void ProcessTracked();
 
     uint Split(uint targetCount, __in_ecount(targetCount) MarkContext ** targetContexts);
+    void SetSharedMarkStackChunkList(SharedMarkStackChunkList * list) { markStack.SetSharedChunkList(list); }
 
     void Abort();
     void Release();
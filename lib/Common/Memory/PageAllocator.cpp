@@ -33,10 +33,14 @@ SegmentBase<T>::SegmentBase(PageAllocatorBase<T> * allocator, size_t pageCount)
     trailingGuardPageCount(0),
     leadingGuardPageCount(0),
     secondaryAllocPageCount(allocator->secondaryAllocPageCount),
+    reserveFlags(0),
     secondaryAllocator(nullptr)
 #if defined(_M_X64_OR_ARM64) && defined(RECYCLER_WRITE_BARRIER)
     , isWriteBarrierAllowed(false)
 #endif
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    , isHugePageBacked(false)
+#endif
 {
     this->segmentPageCount = pageCount + secondaryAllocPageCount;
 }
@@ -57,8 +61,15 @@ SegmentBase<T>::~SegmentBase()
     if (this->address)
     {
         char* originalAddress = this->address - (leadingGuardPageCount * AutoSystemInfo::PageSize);
-        GetAllocator()->GetVirtualAllocator()->Free(originalAddress, GetPageCount() * AutoSystemInfo::PageSize, MEM_RELEASE);
+        GetAllocator()->ReleaseSegmentReservation(originalAddress, GetPageCount() * AutoSystemInfo::PageSize, this->reserveFlags, this->IsInCustomHeapAllocator(),
+            leadingGuardPageCount == 0 && trailingGuardPageCount == 0);
         GetAllocator()->ReportFree(this->segmentPageCount * AutoSystemInfo::PageSize); //Note: We reported the guard pages free when we decommitted them during segment initialization
+#if ENABLE_HUGE_PAGE_SEGMENTS
+        if (this->isHugePageBacked)
+        {
+            GetAllocator()->ReportHugePageSegmentFree(this->segmentPageCount);
+        }
+#endif
 #if defined(_M_X64_OR_ARM64) && defined(RECYCLER_WRITE_BARRIER_BYTE)
         RecyclerWriteBarrierManager::OnSegmentFree(this->address, this->segmentPageCount);
 #endif
@@ -72,9 +83,24 @@ SegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
     Assert(this->address == nullptr);
     char* originalAddress = nullptr;
     bool addGuardPages = false;
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    // A segment smaller than a huge page can't be backed by one, so don't align it
+    if ((allocFlags & MEM_LARGE_PAGES) != 0 && this->segmentPageCount * AutoSystemInfo::PageSize < HugePageSize)
+    {
+        allocFlags &= ~MEM_LARGE_PAGES;
+    }
+#endif
     if (!excludeGuardPages)
     {
-        addGuardPages = (this->segmentPageCount * AutoSystemInfo::PageSize) > VirtualAllocThreshold;
+        size_t guardPageThreshold = VirtualAllocThreshold;
+#if ENABLE_HUGE_PAGE_SEGMENTS
+        // Guard pages would move a huge page segment off its 2MB boundary
+        if ((allocFlags & MEM_LARGE_PAGES) != 0)
+        {
+            guardPageThreshold = max(guardPageThreshold, static_cast<size_t>(HugePageSize));
+        }
+#endif
+        addGuardPages = (this->segmentPageCount * AutoSystemInfo::PageSize) > guardPageThreshold;
 #if _M_IX86_OR_ARM32
         unsigned int randomNumber2 = static_cast<unsigned int>(Math::Rand());
         addGuardPages = addGuardPages && (randomNumber2 % 4 == 1);
@@ -107,7 +133,7 @@ SegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
         return false;
     }
 
-    this->address = (char *)GetAllocator()->GetVirtualAllocator()->Alloc(NULL, totalPages * AutoSystemInfo::PageSize, MEM_RESERVE | allocFlags, PAGE_READWRITE, this->IsInCustomHeapAllocator());
+    this->address = (char *)GetAllocator()->ReserveSegment(totalPages * AutoSystemInfo::PageSize, allocFlags, this->IsInCustomHeapAllocator());
 
     if (this->address == nullptr)
     {
@@ -116,6 +142,8 @@ SegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
     }
 
     originalAddress = this->address;
+    // The flags actually reserved with, so the shared segment pool hands the range out to a matching request only
+    this->reserveFlags = allocFlags & ~MEM_COMMIT;
     bool committed = (allocFlags & MEM_COMMIT) != 0;
     if (addGuardPages)
     {
@@ -156,6 +184,14 @@ SegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
     }
 #endif
 
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    if ((allocFlags & MEM_LARGE_PAGES) != 0)
+    {
+        this->isHugePageBacked = true;
+        GetAllocator()->ReportHugePageSegmentAlloc(this->segmentPageCount);
+    }
+#endif
+
     return true;
 }
 
@@ -609,11 +645,19 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::PageAllocatorBase(Allo
     maxFreePageCount(maxFreePageCount),
     freePageCount(0),
     allocFlags(0),
+    preferredNumaNode(NUMA_NO_PREFERRED_NODE),
+    useSharedSegmentPool(false),
     zeroPages(zeroPages),
 #if ENABLE_BACKGROUND_PAGE_ZEROING
     queueZeroPages(false),
     hasZeroQueuedPages(false),
     backgroundPageQueue(backgroundPageQueue),
+#endif
+#if ENABLE_LAZY_PAGE_ZEROING
+    lazyZeroPageCount(0),
+#endif
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    hugePageSegmentPageCount(0),
 #endif
     minFreePageCount(0),
     isUsed(false),
@@ -992,6 +1036,13 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::FillFreePages(__in voi
 {
 #if DBG
     MemSetLocal(address, DbgMemFill, AutoSystemInfo::PageSize * pageCount);
+#if ENABLE_LAZY_PAGE_ZEROING
+    // Reset large runs in debug builds too, so that the filled pages are checked to read back as zero
+    if (ZeroPages())
+    {
+        TryLazyZeroPages(address, pageCount);
+    }
+#endif
 #else
 #ifdef RECYCLER_MEMORY_VERIFY
     if (verifyEnabled)
@@ -1001,6 +1052,12 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::FillFreePages(__in voi
 #endif
     if (ZeroPages())
     {
+#if ENABLE_LAZY_PAGE_ZEROING
+        if (TryLazyZeroPages(address, pageCount))
+        {
+            return;
+        }
+#endif
         //
         // Do memset via non-temporal store to avoid evicting existing processor cache.
         // This helps low-end machines with limited cache size.
@@ -1020,6 +1077,137 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::FillFreePages(__in voi
 
 }
 
+#if ENABLE_LAZY_PAGE_ZEROING
+//
+// Without a background thread to zero freed pages, large runs are handed back to
+// the OS instead (MEM_RESET, which the PAL maps to madvise(MADV_DONTNEED)). The
+// pages stay committed in the segment, and the kernel supplies zero-filled pages
+// on the next touch, so the zeroing cost moves off the script thread and the
+// physical pages are returned to the system in the meantime.
+//
+template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
+bool
+PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::TryLazyZeroPages(__in void * address, uint pageCount)
+{
+    uint threshold = (uint)CONFIG_FLAG(LazyZeroPageThreshold);
+    if (threshold == 0 || pageCount < threshold || this->processHandle != GetCurrentProcess())
+    {
+        return false;
+    }
+
+    // The pre-reserved allocator only supports committing code pages in its region
+    if (this->allocatorType != GetAllocatorType<VirtualAllocWrapper>())
+    {
+        return false;
+    }
+
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    // Discarding part of a huge page splits it; zero in place to keep the segment huge page backed
+    if (this->IsHugePageSegmentsEnabled())
+    {
+        return false;
+    }
+#endif
+
+    if (this->GetVirtualAllocator()->Alloc(address, AutoSystemInfo::PageSize * pageCount, MEM_RESET, PAGE_READWRITE, this->type == PageAllocatorType::PageAllocatorType_CustomHeap) == nullptr)
+    {
+        return false;
+    }
+
+#if DBG
+    // The run was just filled with DbgMemFill; a reset page reads back as zero throughout, so one word per page will do
+    for (uint i = 0; i < pageCount; i++)
+    {
+        Assert(*(size_t *)((char *)address + i * AutoSystemInfo::PageSize) == 0);
+    }
+#endif
+
+    this->lazyZeroPageCount += pageCount;
+    if (this->policyManager != nullptr)
+    {
+        this->policyManager->ReportLazyZero(AutoSystemInfo::PageSize * pageCount);
+    }
+    return true;
+}
+#endif
+
+#if ENABLE_HUGE_PAGE_SEGMENTS
+//
+// Huge page segments are reserved with MEM_LARGE_PAGES, which the PAL treats as
+// a transparent huge page hint: the reservation is aligned to 2MB and committed
+// ranges are advised with MADV_HUGEPAGE. Only segments of at least 2MB get the
+// hint (see SegmentBase::Initialize). Page segments are at most 1MB (their page
+// bit vectors are sized for PageSegmentBase::MaxPageCount), so only large
+// allocations that get a segment of their own are covered. Only segments
+// allocated after this call are affected.
+//
+template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
+void
+PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::EnableHugePageSegments()
+{
+    Assert(segments.Empty());
+    Assert(fullSegments.Empty());
+    Assert(emptySegments.Empty());
+    Assert(decommitSegments.Empty());
+    Assert(largeSegments.Empty());
+
+    allocFlags |= MEM_LARGE_PAGES;
+}
+
+//
+// Whether the kernel actually backs a hinted segment with huge pages is up to it,
+// so ask it (the PAL reads /proc/self/smaps). This is a diagnostic, not cheap.
+//
+template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
+template <typename T>
+size_t
+PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::GetHugePageBackedBytes(DListBase<T> * segmentList)
+{
+    size_t byteCount = 0;
+    typename DListBase<T>::Iterator segmentIterator(segmentList);
+    while (segmentIterator.Next())
+    {
+        T& segment = segmentIterator.Data();
+        if (segment.IsHugePageBacked())
+        {
+            byteCount += PAL_GetHugePageBackedSize(segment.GetAddress(), segment.GetAvailablePageCount() * AutoSystemInfo::PageSize);
+        }
+    }
+    return byteCount;
+}
+
+template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
+size_t
+PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::GetHugePageBackedBytes()
+{
+    if (this->hugePageSegmentPageCount == 0)
+    {
+        return 0;
+    }
+
+    return GetHugePageBackedBytes(&segments)
+        + GetHugePageBackedBytes(&fullSegments)
+        + GetHugePageBackedBytes(&emptySegments)
+        + GetHugePageBackedBytes(&decommitSegments)
+        + GetHugePageBackedBytes(&largeSegments);
+}
+
+template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
+void
+PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::ReportHugePageSegmentAlloc(size_t pageCount)
+{
+    this->hugePageSegmentPageCount += pageCount;
+}
+
+template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
+void
+PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::ReportHugePageSegmentFree(size_t pageCount)
+{
+    Assert(this->hugePageSegmentPageCount >= pageCount);
+    this->hugePageSegmentPageCount -= pageCount;
+}
+#endif
+
 template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
 template <bool notPageAligned>
 char *
@@ -1163,6 +1351,176 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::GetVirtualAllocator()
     return reinterpret_cast<TVirtualAlloc*>(this->virtualAllocator);
 }
 
+template <>
+LPVOID PageAllocatorBase<VirtualAllocWrapper>::ReserveSegment(size_t byteCount, DWORD allocFlags, bool isCustomHeapAllocation)
+{
+    if (this->useSharedSegmentPool && !isCustomHeapAllocation && this->processHandle == GetCurrentProcess())
+    {
+        char * address = SharedSegmentPool::Take(byteCount / AutoSystemInfo::PageSize, allocFlags, this->preferredNumaNode);
+        if (address != nullptr)
+        {
+            return address;
+        }
+    }
+
+    // Only plain in-process data segments can be placed on a node; code pages
+    // go through VirtualAllocWrapper for the JIT and CFG protection handling
+    if (this->preferredNumaNode != NUMA_NO_PREFERRED_NODE && !isCustomHeapAllocation)
+    {
+        LPVOID address = ::VirtualAllocExNuma(GetCurrentProcess(), NULL, byteCount, MEM_RESERVE | allocFlags, PAGE_READWRITE, this->preferredNumaNode);
+        if (address == nullptr)
+        {
+            MemoryOperationLastError::RecordLastError();
+        }
+        return address;
+    }
+
+    return GetVirtualAllocator()->Alloc(NULL, byteCount, MEM_RESERVE | allocFlags, PAGE_READWRITE, isCustomHeapAllocation);
+}
+
+template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
+LPVOID
+PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::ReserveSegment(size_t byteCount, DWORD allocFlags, bool isCustomHeapAllocation)
+{
+    Assert(this->preferredNumaNode == NUMA_NO_PREFERRED_NODE);
+    return GetVirtualAllocator()->Alloc(NULL, byteCount, MEM_RESERVE | allocFlags, PAGE_READWRITE, isCustomHeapAllocation);
+}
+
+template <>
+void PageAllocatorBase<VirtualAllocWrapper>::ReleaseSegmentReservation(char * address, size_t byteCount, DWORD reserveFlags, bool isCustomHeapAllocation, bool canShare)
+{
+    // Segments with guard pages have a different layout; don't hand them to other allocators
+    if (this->useSharedSegmentPool && canShare && !isCustomHeapAllocation && this->processHandle == GetCurrentProcess() &&
+        SharedSegmentPool::Return(address, byteCount / AutoSystemInfo::PageSize, reserveFlags, this->preferredNumaNode))
+    {
+        return;
+    }
+
+    GetVirtualAllocator()->Free(address, byteCount, MEM_RELEASE);
+}
+
+template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
+void
+PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::ReleaseSegmentReservation(char * address, size_t byteCount, DWORD reserveFlags, bool isCustomHeapAllocation, bool canShare)
+{
+    GetVirtualAllocator()->Free(address, byteCount, MEM_RELEASE);
+}
+
+//=============================================================================================================
+// SharedSegmentPool
+//=============================================================================================================
+
+SharedSegmentPool::CachedSegment SharedSegmentPool::cachedSegments[SharedSegmentPool::MaxCachedSegmentCount];
+uint SharedSegmentPool::cachedCount = 0;
+size_t SharedSegmentPool::reuseCount = 0;
+bool SharedSegmentPool::isReleased = false;
+
+CriticalSection *
+SharedSegmentPool::GetLock()
+{
+    // Built on first use and never destroyed, so allocators released during static
+    // destruction, in any order, can still return their segments
+    static void * lockStorage[(sizeof(CriticalSection) + sizeof(void *) - 1) / sizeof(void *)];
+    static CriticalSection * lock = new (lockStorage) CriticalSection();
+    return lock;
+}
+
+char *
+SharedSegmentPool::Take(size_t pageCount, DWORD allocFlags, DWORD numaNode)
+{
+    char * address = nullptr;
+    {
+        AutoCriticalSection autocs(GetLock());
+
+        // Most recently returned first
+        for (uint i = cachedCount; i > 0; i--)
+        {
+            CachedSegment& cachedSegment = cachedSegments[i - 1];
+            if (cachedSegment.pageCount == pageCount && cachedSegment.allocFlags == (allocFlags & ~MEM_COMMIT) && cachedSegment.numaNode == numaNode)
+            {
+                address = cachedSegment.address;
+                cachedSegment = cachedSegments[cachedCount - 1];
+                cachedCount--;
+                reuseCount++;
+                break;
+            }
+        }
+    }
+
+    if (address == nullptr)
+    {
+        return nullptr;
+    }
+
+    // Pooled segments hold no pages; commit them if the caller expects a committed segment
+    size_t byteCount = pageCount * AutoSystemInfo::PageSize;
+    if ((allocFlags & MEM_COMMIT) != 0 && VirtualAllocWrapper::Instance.Alloc(address, byteCount, MEM_COMMIT, PAGE_READWRITE, false) == nullptr)
+    {
+        VirtualAllocWrapper::Instance.Free(address, byteCount, MEM_RELEASE);
+        return nullptr;
+    }
+
+    return address;
+}
+
+bool
+SharedSegmentPool::Return(char * address, size_t pageCount, DWORD allocFlags, DWORD numaNode)
+{
+    uint maxCount = min((uint)CONFIG_FLAG(SharedSegmentPoolMaxCount), MaxCachedSegmentCount);
+    if (maxCount == 0)
+    {
+        return false;
+    }
+
+    // Give the physical pages back before caching the address range. If the pool turns out
+    // to be full, the caller releases the range anyway.
+    if (!VirtualAllocWrapper::Instance.Free(address, pageCount * AutoSystemInfo::PageSize, MEM_DECOMMIT))
+    {
+        return false;
+    }
+
+    AutoCriticalSection autocs(GetLock());
+    if (cachedCount >= maxCount || isReleased)
+    {
+        return false;
+    }
+
+    CachedSegment& cachedSegment = cachedSegments[cachedCount++];
+    cachedSegment.address = address;
+    cachedSegment.pageCount = pageCount;
+    cachedSegment.allocFlags = (allocFlags & ~MEM_COMMIT);
+    cachedSegment.numaNode = numaNode;
+    return true;
+}
+
+uint
+SharedSegmentPool::GetCachedSegmentCount()
+{
+    AutoCriticalSection autocs(GetLock());
+    return cachedCount;
+}
+
+size_t
+SharedSegmentPool::GetReuseCount()
+{
+    AutoCriticalSection autocs(GetLock());
+    return reuseCount;
+}
+
+void
+SharedSegmentPool::ReleaseAll()
+{
+    AutoCriticalSection autocs(GetLock());
+
+    // Segments released from now on are unmapped by their allocator
+    isReleased = true;
+    while (cachedCount != 0)
+    {
+        CachedSegment& cachedSegment = cachedSegments[--cachedCount];
+        VirtualAllocWrapper::Instance.Free(cachedSegment.address, cachedSegment.pageCount * AutoSystemInfo::PageSize, MEM_RELEASE);
+    }
+}
+
 template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
 char *
 PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::Alloc(size_t * pageCount, TSegment ** segment)
@@ -2355,6 +2713,12 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::DumpStats() const
 
     Output::Print(_u("  Free/Decommit/Min Free Pages              : %4d %4d %4d\n"),
         this->freePageCount, this->decommitPageCount, this->minFreePageCount);
+#if ENABLE_LAZY_PAGE_ZEROING
+    Output::Print(_u("  Lazy Zeroed Pages                         : %4d\n"), this->lazyZeroPageCount);
+#endif
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    Output::Print(_u("  Huge Page Segment Pages                   : %4d\n"), this->hugePageSegmentPageCount);
+#endif
 }
 #endif
 
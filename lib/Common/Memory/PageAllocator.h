@@ -189,6 +189,10 @@ public:
     }
 
 #endif
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    static const uint HugePageSize = 2 * 1024 * 1024;
+    bool IsHugePageBacked() const { return isHugePageBacked; }
+#endif
 
 protected:
 #if _M_IX86_OR_ARM32
@@ -205,9 +209,13 @@ protected:
     uint trailingGuardPageCount;
     uint leadingGuardPageCount;
     uint   secondaryAllocPageCount;
+    DWORD  reserveFlags;
 #if defined(_M_X64_OR_ARM64) && defined(RECYCLER_WRITE_BARRIER)
     bool   isWriteBarrierAllowed;
 #endif
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    bool   isHugePageBacked;
+#endif
 };
 
 /*
@@ -474,6 +482,49 @@ template<> inline PageAllocatorBaseCommon::AllocatorType PageAllocatorBaseCommon
 template<> inline PageAllocatorBaseCommon::AllocatorType PageAllocatorBaseCommon::GetAllocatorType<PreReservedSectionAllocWrapper>() { return AllocatorType::PreReservedSectionAlloc; };
 #endif
 
+/*
+ * Process-wide cache of released segment reservations. Page allocators that
+ * enable it hand their segments back here instead of unmapping them, and take
+ * new segments from here before reserving fresh address space, so runtimes in
+ * the same process skip the reserve/release round trip.
+ *
+ * This is an address space cache only: segments are decommitted before they
+ * are cached, so no committed pages are shared between runtimes, and there is
+ * no per-runtime quota. Cached segments hold no physical memory and aren't
+ * charged to any runtime's AllocationPolicyManager. The taking runtime is
+ * charged for the segment through the usual RequestAlloc before it asks for
+ * one, so memory limits keep working. A segment is only handed out for the
+ * same size, NUMA node and reserve flags it was reserved with.
+ */
+class SharedSegmentPool
+{
+public:
+    static char * Take(size_t pageCount, DWORD allocFlags, DWORD numaNode);
+    static bool Return(char * address, size_t pageCount, DWORD allocFlags, DWORD numaNode);
+    static void ReleaseAll();
+
+    static uint GetCachedSegmentCount();
+    static size_t GetReuseCount();
+
+    static uint const MaxCachedSegmentCount = 256;
+
+private:
+    struct CachedSegment
+    {
+        char * address;
+        size_t pageCount;
+        DWORD allocFlags;
+        DWORD numaNode;
+    };
+
+    static CriticalSection * GetLock();
+
+    static CachedSegment cachedSegments[MaxCachedSegmentCount];
+    static uint cachedCount;
+    static size_t reuseCount;
+    static bool isReleased;
+};
+
 /*
  * This allocator is responsible for allocating and freeing pages. It does
  * so by virtue of allocating segments for groups of pages, and then handing
@@ -552,6 +603,8 @@ public:
 
     //VirtualAllocator APIs
     TVirtualAlloc * GetVirtualAllocator() const;
+    LPVOID ReserveSegment(size_t byteCount, DWORD allocFlags, bool isCustomHeapAllocation);
+    void ReleaseSegmentReservation(char * address, size_t byteCount, DWORD reserveFlags, bool isCustomHeapAllocation, bool canShare);
 
     PageAllocation * AllocPagesForBytes(DECLSPEC_GUARD_OVERFLOW size_t requestedBytes);
     PageAllocation * AllocAllocation(DECLSPEC_GUARD_OVERFLOW size_t pageCount);
@@ -586,6 +639,21 @@ public:
 #if ENABLE_BACKGROUND_PAGE_FREEING
     void FlushBackgroundPages();
 #endif
+    // Bind the memory of segments allocated from now on to the given NUMA node
+    void SetPreferredNumaNode(DWORD numaNode) { preferredNumaNode = numaNode; }
+    DWORD GetPreferredNumaNode() const { return preferredNumaNode; }
+
+    // Release segments to the SharedSegmentPool and take new ones from it
+    void EnableSharedSegmentPool() { useSharedSegmentPool = true; }
+    bool IsSharedSegmentPoolEnabled() const { return useSharedSegmentPool; }
+
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    // Reserve new segments of 2MB or more 2MB aligned, and advise their committed pages for transparent huge pages
+    void EnableHugePageSegments();
+    bool IsHugePageSegmentsEnabled() const { return (allocFlags & MEM_LARGE_PAGES) != 0; }
+    size_t GetHugePageSegmentPageCount() const { return hugePageSegmentPageCount; }
+    size_t GetHugePageBackedBytes();
+#endif
 
     bool DisableAllocationOutOfMemory() const { return disableAllocationOutOfMemory; }
     void ResetDisableAllocationOutOfMemory() { disableAllocationOutOfMemory = false; }
@@ -650,6 +718,9 @@ protected:
 
     void FillAllocPages(__in void * address, uint pageCount);
     void FillFreePages(__in void * address, uint pageCount);
+#if ENABLE_LAZY_PAGE_ZEROING
+    bool TryLazyZeroPages(__in void * address, uint pageCount);
+#endif
 
     struct FreePageEntry : public SLIST_ENTRY
     {
@@ -698,6 +769,8 @@ protected:
 
     uint maxAllocPageCount;
     DWORD allocFlags;
+    DWORD preferredNumaNode;
+    bool useSharedSegmentPool;
     uint maxFreePageCount;
     size_t freePageCount;
     uint secondaryAllocPageCount;
@@ -719,6 +792,12 @@ protected:
     bool queueZeroPages;
     bool hasZeroQueuedPages;
 #endif
+#endif
+#if ENABLE_LAZY_PAGE_ZEROING
+    size_t lazyZeroPageCount;
+#endif
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    size_t hugePageSegmentPageCount;
 #endif
 
     // Idle Decommit
@@ -850,6 +929,13 @@ private:
         }
     }
 
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    void ReportHugePageSegmentAlloc(size_t pageCount);
+    void ReportHugePageSegmentFree(size_t pageCount);
+    template <typename T>
+    size_t GetHugePageBackedBytes(DListBase<T> * segmentList);
+#endif
+
     template <typename T>
     void ReleaseSegmentList(DListBase<T> * segmentList);
 
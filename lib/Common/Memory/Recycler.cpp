@@ -831,7 +831,9 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
 #if ENABLE_CONCURRENT_GC
     // Default to non-concurrent
     uint numProcs = (uint)AutoSystemInfo::Data.GetNumberOfPhysicalProcessors();
-    this->maxParallelism = (numProcs > 4) || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase) ? 4 : numProcs;
+    uint maxParallelMarkThreads = max(1u, min((uint)GetRecyclerFlagsTable().MaxParallelMarkThreads, 4u));
+    this->maxParallelism = (numProcs > maxParallelMarkThreads) || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase) ? maxParallelMarkThreads : numProcs;
+    this->parallelMarkThreadCount = this->maxParallelism;
 
     if (forceInThread)
     {
@@ -920,6 +922,52 @@ Recycler::Prime()
     ForRecyclerPageAllocator(Prime(RecyclerPageAllocator::DefaultPrimePageCount));
 }
 
+void
+Recycler::SetPreferredNumaNode(DWORD numaNode)
+{
+    // Heap pages and the main mark stack are touched by the owning thread. The
+    // parallel mark page pools belong to the background threads and are left unbound.
+    recyclerPageAllocator.SetPreferredNumaNode(numaNode);
+    recyclerLargeBlockPageAllocator.SetPreferredNumaNode(numaNode);
+#ifdef RECYCLER_WRITE_BARRIER_ALLOC_SEPARATE_PAGE
+    recyclerWithBarrierPageAllocator.SetPreferredNumaNode(numaNode);
+#endif
+    markPagePool.GetPageAllocator()->SetPreferredNumaNode(numaNode);
+}
+
+void
+Recycler::EnableSharedSegmentPool()
+{
+    recyclerPageAllocator.EnableSharedSegmentPool();
+    recyclerLargeBlockPageAllocator.EnableSharedSegmentPool();
+#ifdef RECYCLER_WRITE_BARRIER_ALLOC_SEPARATE_PAGE
+    recyclerWithBarrierPageAllocator.EnableSharedSegmentPool();
+#endif
+}
+
+#if ENABLE_HUGE_PAGE_SEGMENTS
+void
+Recycler::EnableHugePageSegments()
+{
+    // Small and medium heap blocks come from page segments, which are at most 1MB
+    // and never get the huge page hint, so only the large block allocator is
+    // switched over; the others keep lazy page zeroing. This must happen before
+    // the first allocation.
+    recyclerLargeBlockPageAllocator.EnableHugePageSegments();
+}
+
+size_t
+Recycler::GetHugePageBackedBytes()
+{
+    size_t byteCount = recyclerPageAllocator.GetHugePageBackedBytes()
+        + recyclerLargeBlockPageAllocator.GetHugePageBackedBytes();
+#ifdef RECYCLER_WRITE_BARRIER_ALLOC_SEPARATE_PAGE
+    byteCount += recyclerWithBarrierPageAllocator.GetHugePageBackedBytes();
+#endif
+    return byteCount;
+}
+#endif
+
 void
 Recycler::AddExternalMemoryUsage(size_t size)
 {
@@ -2297,12 +2345,13 @@ void
 Recycler::DoParallelMark()
 {
     Assert(this->enableParallelMark);
-    Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+    uint threadCount = this->parallelMarkThreadCount;
+    Assert(threadCount > 1 && threadCount <= this->maxParallelism && threadCount <= 4);
 
-    // Split the mark stack into [this->maxParallelism] equal pieces.
+    // Split the mark stack into [threadCount] equal pieces.
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
     MarkContext * splitContexts[3] = { &parallelMarkContext1, &parallelMarkContext2, &parallelMarkContext3 };
-    uint actualSplitCount = markContext.Split(this->maxParallelism - 1, splitContexts);
+    uint actualSplitCount = markContext.Split(threadCount - 1, splitContexts);
 
     Assert(actualSplitCount <= 3);
 
@@ -2322,6 +2371,10 @@ Recycler::DoParallelMark()
         StartQueueTrackedObject();
     }
 
+    // Each mark thread copies its context when it starts, so the contexts have to share their work before then.
+    MarkContext * parallelContexts[4] = { &markContext, &parallelMarkContext1, &parallelMarkContext2, &parallelMarkContext3 };
+    StartSharingParallelMarkWork(parallelContexts, actualSplitCount + 1);
+
     // Kick off marking on the background thread
     bool concurrentSuccess = StartConcurrent(CollectionStateParallelMark);
 
@@ -2376,6 +2429,8 @@ Recycler::DoParallelMark()
         }
     }
 
+    StopSharingParallelMarkWork(parallelContexts, actualSplitCount + 1);
+
     this->collectionState = CollectionStateMark;
 
     // Process tracked objects, if any, then do one final mark phase in case they marked any new objects.
@@ -2399,17 +2454,18 @@ Recycler::DoParallelMark()
 void
 Recycler::DoBackgroundParallelMark()
 {
-    // Split the mark stack into [this->maxParallelism - 1] equal pieces (thus, "- 2" below).
+    // Split the mark stack into [parallelMarkThreadCount - 1] equal pieces (thus, "- 2" below).
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
     // The parallel threads are hardwired to use parallelMarkContext2/3, so we split using those.
     uint actualSplitCount = 0;
     MarkContext * splitContexts[2] = { &parallelMarkContext2, &parallelMarkContext3 };
     if (this->enableParallelMark)
     {
-        Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
-        if (this->maxParallelism > 2)
+        uint threadCount = this->parallelMarkThreadCount;
+        Assert(threadCount >= 1 && threadCount <= this->maxParallelism && threadCount <= 4);
+        if (threadCount > 2)
         {
-            actualSplitCount = markContext.Split(this->maxParallelism - 2, splitContexts);
+            actualSplitCount = markContext.Split(threadCount - 2, splitContexts);
         }
     }
 
@@ -2431,6 +2487,10 @@ Recycler::DoBackgroundParallelMark()
 
     this->collectionState = CollectionStateBackgroundParallelMark;
 
+    // Each mark thread copies its context when it starts, so the contexts have to share their work before then.
+    MarkContext * parallelContexts[3] = { &markContext, &parallelMarkContext2, &parallelMarkContext3 };
+    StartSharingParallelMarkWork(parallelContexts, actualSplitCount + 1);
+
     // Kick off marking on parallel threads too, if there is work for them
     // If the threads haven't been created yet, this will create them (or fail).
     bool parallelSuccess1 = false;
@@ -2467,8 +2527,55 @@ Recycler::DoBackgroundParallelMark()
         }
     }
 
+    StopSharingParallelMarkWork(parallelContexts, actualSplitCount + 1);
+
     this->collectionState = CollectionStateConcurrentMark;
 }
+
+void
+Recycler::StartSharingParallelMarkWork(MarkContext ** contexts, uint contextCount)
+{
+    // Let the mark threads hand full mark stack chunks to whichever of them runs out of work first,
+    // so the split above doesn't have to be even for all of them to stay busy.
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    if (CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ParallelMarkWorkSharingPhase))
+    {
+        return;
+    }
+#endif
+
+    // Without an event to wait on, the mark threads keep to their own share of the split.
+    if (!this->parallelMarkChunkList.EnsureEvent())
+    {
+        return;
+    }
+
+    this->parallelMarkChunkList.Reset();
+    for (uint i = 0; i < contextCount; i++)
+    {
+        contexts[i]->SetSharedMarkStackChunkList(&this->parallelMarkChunkList);
+    }
+}
+
+void
+Recycler::SetParallelMarkThreadCount(uint threadCount)
+{
+    // Only the mark threads started with the recycler can be used
+    this->parallelMarkThreadCount = max(1u, min(threadCount, this->maxParallelism));
+}
+
+void
+Recycler::StopSharingParallelMarkWork(MarkContext ** contexts, uint contextCount)
+{
+    // Every thread stays until the list is drained, so nothing can be left behind on it.
+    Assert(this->parallelMarkChunkList.IsEmpty());
+    Assert(!this->parallelMarkChunkList.HasWaiters());
+
+    for (uint i = 0; i < contextCount; i++)
+    {
+        contexts[i]->SetSharedMarkStackChunkList(nullptr);
+    }
+}
 #endif
 
 size_t
@@ -2503,7 +2610,7 @@ Recycler::RootMark(CollectionState markState)
     this->collectionState = markState;
 
 #if ENABLE_CONCURRENT_GC
-    if (this->enableParallelMark)
+    if (this->enableParallelMark && this->parallelMarkThreadCount > 1)
     {
         this->DoParallelMark();
     }
@@ -819,6 +819,10 @@ private:
     MarkContext parallelMarkContext1;
     MarkContext parallelMarkContext2;
     MarkContext parallelMarkContext3;
+#if ENABLE_CONCURRENT_GC
+    // Full mark stack chunks handed between the contexts above while they mark in parallel.
+    MarkContext::SharedMarkStackChunkList parallelMarkChunkList;
+#endif
 
     // Page pools for above markContexts
     PagePool markPagePool;
@@ -944,6 +948,7 @@ private:
     bool enableConcurrentSweep;
 
     uint maxParallelism;        // Max # of total threads to run in parallel
+    uint parallelMarkThreadCount;   // # of threads a parallel mark uses, up to maxParallelism
 
     byte backgroundRescanCount;             // for ETW events and stats
     byte backgroundFinishMarkCount;
@@ -1105,6 +1110,12 @@ public:
 #endif
 
     void Prime();
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    void EnableHugePageSegments();
+    size_t GetHugePageBackedBytes();
+#endif
+    void SetPreferredNumaNode(DWORD numaNode);
+    void EnableSharedSegmentPool();
 
     void* GetOwnerContext() { return (void*) this->collectionWrapper; }
     PageAllocator * GetPageAllocator() { return threadPageAllocator; }
@@ -1199,6 +1210,10 @@ public:
     BOOL IsConcurrentMarkEnabled() const { return enableConcurrentMark; }
     BOOL IsConcurrentSweepEnabled() const { return enableConcurrentSweep; }
 #endif
+    // Threads, including the collecting one, that a parallel mark uses; 1 when it won't mark in parallel
+    uint GetParallelMarkThreadCount() const { return this->enableParallelMark ? this->parallelMarkThreadCount : 1; }
+    void SetParallelMarkThreadCount(uint threadCount);
+
     template <CollectionFlags flags>
     BOOL FinishConcurrent();
     void ShutdownThread();
@@ -1620,6 +1635,8 @@ private:
 #if ENABLE_CONCURRENT_GC
     void DoParallelMark();
     void DoBackgroundParallelMark();
+    void StartSharingParallelMarkWork(MarkContext ** contexts, uint contextCount);
+    void StopSharingParallelMarkWork(MarkContext ** contexts, uint contextCount);
 #endif
 
     size_t RootMark(CollectionState markState);
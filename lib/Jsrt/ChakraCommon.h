@@ -424,7 +424,44 @@ typedef UINT32 DWORD;
         ///     Calling <c>JsSetException</c> will also dispatch the exception to the script debugger
         ///     (if any) giving the debugger a chance to break on the exception.
         /// </summary>
-        JsRuntimeAttributeDispatchSetExceptionsToDebugger = 0x00000040
+        JsRuntimeAttributeDispatchSetExceptionsToDebugger = 0x00000040,
+        /// <summary>
+        ///     The runtime will reserve the segments of its large garbage collected objects and large
+        ///     native code allocations of 2MB or more on 2MB boundaries and ask the OS to back them
+        ///     with transparent huge pages. This can reduce TLB misses for large arrays and buffers.
+        ///     Small objects are not covered. Ignored on platforms without transparent huge pages.
+        /// </summary>
+        JsRuntimeAttributeEnableHugePages = 0x00000080,
+        /// <summary>
+        ///     The runtime will place its garbage collected heap on the NUMA node of the thread that
+        ///     first uses it. Meant for hosts that keep each runtime on a thread pinned to one node.
+        ///     Ignored on single node systems.
+        /// </summary>
+        JsRuntimeAttributeEnableNumaAffinity = 0x00000100,
+        /// <summary>
+        ///     The runtime will give the memory segments it no longer needs to a pool shared by all
+        ///     runtimes in the process that were created with this attribute, and take new segments
+        ///     from that pool before asking the OS for more memory. Only the address space of a pooled
+        ///     segment is kept: its pages are given back to the OS, and it no longer counts toward the
+        ///     memory limit of the runtime that gave it up.
+        /// </summary>
+        JsRuntimeAttributeEnableSharedPagePool = 0x00000200,
+        /// <summary>
+        ///     The runtime will keep track of the profile data the JIT collects for each script, so
+        ///     that it can be saved with <c>JsSerializeScriptProfile</c> and handed to a later run
+        ///     with <c>JsLoadScriptProfile</c>. Costs some memory per profiled function.
+        /// </summary>
+        JsRuntimeAttributeEnableProfilePersistence = 0x00000400,
+        /// <summary>
+        ///     The runtime will do its background JIT work on a pool of threads shared by all runtimes in
+        ///     the process that were created with this attribute, instead of starting its own JIT threads.
+        ///     The pool is sized to the machine, and takes work from the runtimes in turn, so that a
+        ///     runtime with many functions to JIT doesn't hold up the others. Ignored if a thread service
+        ///     callback is given, or if background work is disabled. The native code generated for the
+        ///     runtime counts toward its memory limit, but the memory the pool threads use while compiling
+        ///     does not, since those threads are not owned by any one runtime.
+        /// </summary>
+        JsRuntimeAttributeEnableSharedJitThreadPool = 0x00000800
     } JsRuntimeAttributes;
 
     /// <summary>
@@ -547,5 +547,222 @@ CHAKRA_API
         _In_ JsSourceContext sourceContext,
         _In_ JsValueRef sourceUrl,
         _Out_ JsValueRef *result);
+
+/// <summary>
+///     Gets how much of a runtime's freed memory was zeroed lazily by the operating system.
+/// </summary>
+/// <remarks>
+///     <para>
+///     On platforms without background page zeroing, large runs of freed pages are handed
+///     back to the operating system, which supplies zero-filled pages the next time they are
+///     touched, instead of being zeroed on the thread that frees them. This is the running
+///     total of those runs. Always zero on platforms that zero freed pages in the background.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime whose lazily zeroed memory is to be retrieved.</param>
+/// <param name="lazyZeroedMemory">The total size of the freed memory zeroed lazily, in bytes.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetRuntimeLazyZeroedMemory(
+        _In_ JsRuntimeHandle runtime,
+        _Out_ size_t *lazyZeroedMemory);
+
+/// <summary>
+///     Gets the portion of a runtime's memory usage that is backed by transparent huge pages.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Only memory of runtimes created with <c>JsRuntimeAttributeEnableHugePages</c> is
+///     counted, as the operating system reports it at the time of the call. Only segments of
+///     2MB or more, which hold large objects, can be huge page backed. It is included in
+///     the value reported by <c>JsGetRuntimeMemoryUsage</c>. The lookup is slow, so this is
+///     meant for diagnostics. Always zero on platforms without transparent huge pages.
+///     </para>
+///     <para>
+///     Does not require an active script context, but must not be called while the runtime is
+///     running script on another thread.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime whose huge page usage is to be retrieved.</param>
+/// <param name="hugePageMemoryUsage">The huge page backed memory usage of the runtime, in bytes.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetRuntimeHugePageMemoryUsage(
+        _In_ JsRuntimeHandle runtime,
+        _Out_ size_t *hugePageMemoryUsage);
+
+/// <summary>
+///     Gets the state of the memory pool shared by runtimes created with
+///     <c>JsRuntimeAttributeEnableSharedPagePool</c>.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Does not require an active script context, and may be called from any thread.
+///     The pool holds at most 16 segments by default.
+///     </para>
+/// </remarks>
+/// <param name="cachedSegmentCount">The number of memory segments waiting in the pool to be reused.</param>
+/// <param name="reuseCount">The number of times a runtime has taken a segment from the pool.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetSharedPagePoolInfo(
+        _Out_ unsigned int *cachedSegmentCount,
+        _Out_ size_t *reuseCount);
+
+/// <summary>
+///     Sets how many threads, including the one collecting, a runtime's garbage collector uses
+///     to mark in parallel.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context or no context on the calling thread, as
+///     <c>JsCollectGarbage</c> does. The count is capped at the number of mark threads the
+///     runtime started with, which is at most 4, and a count of 1 turns parallel mark off.
+///     </para>
+///     <para>
+///     Not implemented on platforms without concurrent garbage collection, which includes
+///     Linux and macOS, since parallel mark runs on the concurrent collector's threads.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime whose garbage collector is to be configured.</param>
+/// <param name="threadCount">The number of threads to mark with.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorNotImplemented</c> on
+///     platforms without parallel mark, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeParallelMarkThreadCount(
+        _In_ JsRuntimeHandle runtime,
+        _In_ unsigned int threadCount);
+
+/// <summary>
+///     Gets how many threads, including the one collecting, a runtime's garbage collector uses
+///     to mark in parallel.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The count is 1 when the runtime can't mark in parallel.
+///     </para>
+///     <para>
+///     Not implemented on platforms without concurrent garbage collection, which includes
+///     Linux and macOS; the count is set to 0 there.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime whose garbage collector is to be queried.</param>
+/// <param name="threadCount">The number of threads the runtime marks with.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorNotImplemented</c> on
+///     platforms without parallel mark, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetRuntimeParallelMarkThreadCount(
+        _In_ JsRuntimeHandle runtime,
+        _Out_ unsigned int *threadCount);
+
+/// <summary>
+///     Saves the dynamic profile data collected so far for a script.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context, and a runtime created with
+///     <c>JsRuntimeAttributeEnableProfilePersistence</c>.
+///     </para>
+///     <para>
+///     The data is tied to the script's source and to the exact engine build that produced it.
+///     Pass it to <c>JsLoadScriptProfile</c> in a later run, before the same script is run
+///     again, so functions that were warm last time can skip the profiling interpreter.
+///     </para>
+///     <para>
+///     Native code is not saved. Those functions are still JIT compiled again in the later run,
+///     but from the saved profile rather than after a fresh round of profiling.
+///     </para>
+/// </remarks>
+/// <param name="sourceContext">The cookie the script was run with.</param>
+/// <param name="buffer">
+///     The profile data as an ArrayBuffer. Empty if nothing has been profiled for the script yet.
+///     Profiles of functions that have been garbage collected are not saved.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSerializeScriptProfile(
+        _In_ JsSourceContext sourceContext,
+        _Out_ JsValueRef *buffer);
+
+/// <summary>
+///     Hands back profile data saved with <c>JsSerializeScriptProfile</c> for a script
+///     that is about to be run.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context, and a runtime created with
+///     <c>JsRuntimeAttributeEnableProfilePersistence</c>.
+///     </para>
+///     <para>
+///     The profile is used when a script with the same source context is next parsed in the
+///     current script context. Data saved by a different engine build, or damaged since it was
+///     saved, is rejected.
+///     </para>
+///     <para>
+///     The engine does not check that the script is the one the profile was saved for. Only
+///     hand back data this host saved for the same source; a profile for a different script
+///     only steers the JIT compiler wrong, but it should not come from an untrusted store.
+///     </para>
+/// </remarks>
+/// <param name="sourceContext">The cookie the script will be run with.</param>
+/// <param name="buffer">The profile data as an ArrayBuffer.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsLoadScriptProfile(
+        _In_ JsSourceContext sourceContext,
+        _In_ JsValueRef buffer);
+
+/// <summary>
+///     Gets the number of functions waiting to be JIT compiled by the thread pool shared by
+///     runtimes created with <c>JsRuntimeAttributeEnableSharedJitThreadPool</c>.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Does not require an active script context, and may be called from any thread.
+///     Work currently being compiled is not counted. Zero if no runtime uses the shared pool.
+///     </para>
+/// </remarks>
+/// <param name="queueDepth">The number of JIT jobs queued to the shared pool.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetSharedJitQueueDepth(
+        _Out_ unsigned int *queueDepth);
+
+/// <summary>
+///     Gets the number of a runtime's functions that are queued to be JIT compiled in the
+///     background, or being compiled.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Does not require an active script context, but must not be called while the runtime is
+///     running script on another thread. Together with <c>JsGetSharedJitQueueDepth</c>, this shows
+///     how the work of the runtimes sharing a JIT thread pool is progressing.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime whose JIT work is to be counted.</param>
+/// <param name="queueDepth">The number of the runtime's JIT jobs queued or being compiled.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetRuntimeJitQueueDepth(
+        _In_ JsRuntimeHandle runtime,
+        _Out_ unsigned int *queueDepth);
 #endif // NTBUILD
 #endif // _CHAKRACORE_H_
@@ -14,6 +14,7 @@
 #include "Library/DataView.h"
 #include "Library/JavascriptSymbol.h"
 #include "Base/ThreadContextTlsEntry.h"
+#include "Base/ThreadBoundThreadContextManager.h"
 #include "Codex/Utf8Helper.h"
 
 // Parser Includes
@@ -247,7 +248,12 @@ JsErrorCode CreateRuntimeCore(_In_ JsRuntimeAttributes attributes,
             JsRuntimeAttributeDisableEval |
             JsRuntimeAttributeDisableNativeCodeGeneration |
             JsRuntimeAttributeEnableExperimentalFeatures |
-            JsRuntimeAttributeDispatchSetExceptionsToDebugger
+            JsRuntimeAttributeDispatchSetExceptionsToDebugger |
+            JsRuntimeAttributeEnableHugePages |
+            JsRuntimeAttributeEnableNumaAffinity |
+            JsRuntimeAttributeEnableSharedPagePool |
+            JsRuntimeAttributeEnableProfilePersistence |
+            JsRuntimeAttributeEnableSharedJitThreadPool
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
             | JsRuntimeAttributeSerializeLibraryByteCode
 #endif
@@ -299,6 +305,33 @@ JsErrorCode CreateRuntimeCore(_In_ JsRuntimeAttributes attributes,
             threadContext->SetThreadContextFlag(ThreadContextFlagNoJIT);
         }
 
+#if ENABLE_HUGE_PAGE_SEGMENTS
+        if (attributes & JsRuntimeAttributeEnableHugePages)
+        {
+            threadContext->EnableHugePageSegments();
+        }
+#endif
+
+        if (attributes & JsRuntimeAttributeEnableNumaAffinity)
+        {
+            threadContext->EnableNumaAffinity();
+        }
+
+        if (attributes & JsRuntimeAttributeEnableSharedPagePool)
+        {
+            threadContext->EnableSharedSegmentPool();
+        }
+
+        if (attributes & JsRuntimeAttributeEnableProfilePersistence)
+        {
+            threadContext->SetThreadContextFlag(ThreadContextFlagProfilePersistence);
+        }
+
+        if ((attributes & JsRuntimeAttributeEnableSharedJitThreadPool) && threadService == nullptr)
+        {
+            threadContext->SetThreadContextFlag(ThreadContextFlagSharedJitThreadPool);
+        }
+
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
         if (Js::Configuration::Global.flags.PrimeRecycler)
         {
@@ -2585,6 +2618,125 @@ CHAKRA_API JsGetRuntimeMemoryUsage(_In_ JsRuntimeHandle runtimeHandle, _Out_ siz
     return JsNoError;
 }
 
+#ifndef NTBUILD
+CHAKRA_API JsGetRuntimeLazyZeroedMemory(_In_ JsRuntimeHandle runtimeHandle, _Out_ size_t * lazyZeroedMemory)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+    PARAM_NOT_NULL(lazyZeroedMemory);
+    *lazyZeroedMemory = 0;
+
+    ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+    AllocationPolicyManager * allocPolicyManager = threadContext->GetAllocationPolicyManager();
+
+    *lazyZeroedMemory = allocPolicyManager->GetLazyZeroedMemory();
+
+    return JsNoError;
+}
+
+CHAKRA_API JsGetRuntimeHugePageMemoryUsage(_In_ JsRuntimeHandle runtimeHandle, _Out_ size_t * hugePageMemoryUsage)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+    PARAM_NOT_NULL(hugePageMemoryUsage);
+    *hugePageMemoryUsage = 0;
+
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+
+    *hugePageMemoryUsage = threadContext->GetHugePageBackedBytes();
+#endif
+
+    return JsNoError;
+}
+
+CHAKRA_API JsGetSharedPagePoolInfo(_Out_ unsigned int * cachedSegmentCount, _Out_ size_t * reuseCount)
+{
+    PARAM_NOT_NULL(cachedSegmentCount);
+    PARAM_NOT_NULL(reuseCount);
+
+    *cachedSegmentCount = SharedSegmentPool::GetCachedSegmentCount();
+    *reuseCount = SharedSegmentPool::GetReuseCount();
+
+    return JsNoError;
+}
+
+CHAKRA_API JsSetRuntimeParallelMarkThreadCount(_In_ JsRuntimeHandle runtimeHandle, _In_ unsigned int threadCount)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+#if ENABLE_CONCURRENT_GC
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        threadContext->EnsureRecycler()->SetParallelMarkThreadCount(threadCount);
+        return JsNoError;
+#else
+        // Parallel mark runs on the concurrent GC threads
+        return JsErrorNotImplemented;
+#endif
+    });
+}
+
+CHAKRA_API JsGetRuntimeParallelMarkThreadCount(_In_ JsRuntimeHandle runtimeHandle, _Out_ unsigned int * threadCount)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+    PARAM_NOT_NULL(threadCount);
+
+#if ENABLE_CONCURRENT_GC
+    *threadCount = 1;
+
+    Recycler * recycler = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext()->GetRecycler();
+    if (recycler != nullptr)
+    {
+        *threadCount = recycler->GetParallelMarkThreadCount();
+    }
+
+    return JsNoError;
+#else
+    *threadCount = 0;
+    return JsErrorNotImplemented;
+#endif
+}
+
+CHAKRA_API JsGetSharedJitQueueDepth(_Out_ unsigned int * queueDepth)
+{
+    PARAM_NOT_NULL(queueDepth);
+
+#if ENABLE_NATIVE_CODEGEN
+    *queueDepth = ThreadBoundThreadContextManager::GetSharedJobProcessorQueuedJobCount();
+#else
+    *queueDepth = 0;
+#endif
+
+    return JsNoError;
+}
+
+CHAKRA_API JsGetRuntimeJitQueueDepth(_In_ JsRuntimeHandle runtimeHandle, _Out_ unsigned int * queueDepth)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+    PARAM_NOT_NULL(queueDepth);
+
+#if ENABLE_NATIVE_CODEGEN
+    ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+    *queueDepth = threadContext->GetQueuedJitJobCount();
+#else
+    *queueDepth = 0;
+#endif
+
+    return JsNoError;
+}
+#endif
+
 CHAKRA_API JsSetRuntimeMemoryLimit(_In_ JsRuntimeHandle runtimeHandle, _In_ size_t memoryLimit)
 {
     VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
@@ -4553,4 +4705,81 @@ CHAKRA_API JsRunSerialized(
         sourceContext, // use the same user provided sourceContext as scriptLoadSourceContext
         buffer, bufferVal, sourceContext, url, false, result);
 }
+
+CHAKRA_API JsSerializeScriptProfile(
+    _In_ JsSourceContext sourceContext,
+    _Out_ JsValueRef *bufferVal)
+{
+    PARAM_NOT_NULL(bufferVal);
+    *bufferVal = nullptr;
+
+    if (sourceContext == JS_SOURCE_CONTEXT_NONE)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+    return ContextAPIWrapper_NoRecord<true>([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        if (!scriptContext->GetThreadContext()->IsProfilePersistenceEnabled())
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        SourceContextInfo * sourceContextInfo = scriptContext->GetSourceContextInfo(sourceContext, nullptr);
+        if (sourceContextInfo == nullptr)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        size_t bufferSize = Js::SourceDynamicProfileManager::SaveToBuffer(scriptContext, sourceContextInfo, nullptr, 0);
+        if (bufferSize > UINT_MAX)
+        {
+            return JsErrorOutOfMemory;
+        }
+
+        Js::ArrayBuffer * arrayBuffer = scriptContext->GetLibrary()->CreateArrayBuffer((uint32)bufferSize);
+        if (bufferSize != 0 &&
+            Js::SourceDynamicProfileManager::SaveToBuffer(scriptContext, sourceContextInfo, (char *)arrayBuffer->GetBuffer(), bufferSize) == 0)
+        {
+            return JsErrorFatal;
+        }
+
+        *bufferVal = arrayBuffer;
+        return JsNoError;
+    });
+#else
+    return JsErrorNotImplemented;
+#endif
+}
+
+CHAKRA_API JsLoadScriptProfile(
+    _In_ JsSourceContext sourceContext,
+    _In_ JsValueRef bufferVal)
+{
+    PARAM_NOT_NULL(bufferVal);
+
+    if (sourceContext == JS_SOURCE_CONTEXT_NONE || !Js::ArrayBuffer::Is(bufferVal))
+    {
+        return JsErrorInvalidArgument;
+    }
+
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        if (!scriptContext->GetThreadContext()->IsProfilePersistenceEnabled())
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::ArrayBuffer * arrayBuffer = Js::ArrayBuffer::FromVar(bufferVal);
+        if (!scriptContext->LoadSourceProfile(sourceContext, (char const *)arrayBuffer->GetBuffer(), arrayBuffer->GetByteLength()))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        return JsNoError;
+    });
+#else
+    return JsErrorNotImplemented;
+#endif
+}
 #endif // NTBUILD
@@ -111,8 +111,11 @@ void JsrtCallbackState::ObjectBeforeCallectCallbackWrapper(JsObjectBeforeCollect
     // we do not track the main thread. When it exits do the cleanup below
     atexit([]() {
         ThreadBoundThreadContextManager::DestroyContextAndEntryForCurrentThread();
+        // Runtimes created with JsRuntimeAttributeEnableSharedJitThreadPool share these jit threads
+        ThreadBoundThreadContextManager::DestroySharedJobProcessor();
 
         JsrtRuntime::Uninitialize();
+        SharedSegmentPool::ReleaseAll();
 
         // thread-bound entrypoint should be able to get cleanup correctly, however tlsentry
         // for current thread might be left behind if this thread was initialized.
@@ -441,6 +441,7 @@ namespace Js
 #if ENABLE_NATIVE_CODEGEN
         BYTE                pendingInlinerVersion;
         ImplicitCallFlags   pendingImplicitCallFlags;
+        volatile bool       isCodeGenAbandoned; // a rejit superseded this entry point; set on the foreground thread, read by the backend
         uint32              pendingPolymorphicCacheState;
 
         class JitTransferData
@@ -645,7 +646,7 @@ namespace Js
         EntryPointInfo(Js::JavascriptMethod method, JavascriptLibrary* library, void* validationCookie, ThreadContext* context = nullptr, bool isLoopBody = false) :
             ProxyEntryPointInfo(method, context), tag(1), nativeEntryPointProcessed(false),
 #if ENABLE_NATIVE_CODEGEN
-            nativeThrowSpanSequence(nullptr), workItem(nullptr), weakFuncRefSet(nullptr),
+            nativeThrowSpanSequence(nullptr), workItem(nullptr), weakFuncRefSet(nullptr), isCodeGenAbandoned(false),
             jitTransferData(nullptr), sharedPropertyGuards(nullptr), propertyGuardCount(0), propertyGuardWeakRefs(nullptr),
             equivalentTypeCacheCount(0), equivalentTypeCaches(nullptr), constructorCaches(nullptr), state(NotScheduled), inProcJITNaticeCodedata(nullptr),
             numberChunks(nullptr), numberPageSegments(nullptr), polymorphicInlineCacheInfo(nullptr), runtimeTypeRefs(nullptr),
@@ -985,6 +986,8 @@ namespace Js
         void SetPendingInlinerVersion(BYTE version) { this->pendingInlinerVersion = version; }
         ImplicitCallFlags GetPendingImplicitCallFlags() const { return this->pendingImplicitCallFlags; }
         void SetPendingImplicitCallFlags(ImplicitCallFlags flags) { this->pendingImplicitCallFlags = flags; }
+        bool IsCodeGenAbandoned() const { return this->isCodeGenAbandoned; }
+        void SetCodeGenAbandoned() { this->isCodeGenAbandoned = true; }
         virtual void Invalidate(bool prolongEntryPoint) { Assert(false); }
         void RecordBailOutMap(JsUtil::List<LazyBailOutRecord, ArenaAllocator>* bailoutMap);
         void RecordInlineeFrameMap(JsUtil::List<NativeOffsetInlineeFramePair, ArenaAllocator>* tempInlineeFrameMap);
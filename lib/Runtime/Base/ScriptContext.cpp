@@ -209,6 +209,7 @@ namespace Js
 
 #ifdef BGJIT_STATS
         interpretedCount = maxFuncInterpret = funcJITCount = bytecodeJITCount = interpretedCallsHighPri = jitCodeUsed = funcJitCodeUsed = loopJITCount = speculativeJitCount = 0;
+        regAllocTime = fastRegAllocCount = 0;
 #endif
 
 #ifdef PROFILE_TYPES
@@ -2383,7 +2384,17 @@ namespace Js
 #if ENABLE_PROFILE_INFO
         if (!this->startupComplete)
         {
-            sourceContextInfo->sourceDynamicProfileManager = SourceDynamicProfileManager::LoadFromDynamicProfileStorage(sourceContextInfo, this, profileDataCache);
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+            if (this->cache->loadedProfileMap != nullptr &&
+                this->cache->loadedProfileMap->TryGetValueAndRemove(sourceContext, &sourceContextInfo->sourceDynamicProfileManager))
+            {
+                OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Using host loaded profile for %s\n"), url != nullptr ? url : _u("<no url>"));
+            }
+            else
+#endif
+            {
+                sourceContextInfo->sourceDynamicProfileManager = SourceDynamicProfileManager::LoadFromDynamicProfileStorage(sourceContextInfo, this, profileDataCache);
+            }
             Assert(sourceContextInfo->sourceDynamicProfileManager != NULL);
         }
 
@@ -2392,6 +2403,34 @@ namespace Js
         return sourceContextInfo;
     }
 
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+    //
+    // Takes a profile saved by an earlier run (see SourceDynamicProfileManager::SaveToBuffer) for the script
+    // the host is going to parse with this context cookie. Fails if that script has already been parsed.
+    //
+    bool ScriptContext::LoadSourceProfile(DWORD_PTR hostSourceContext, __in_bcount(length) char const * buffer, size_t length)
+    {
+        Assert(hostSourceContext != Js::Constants::NoHostSourceContext);
+        if (this->startupComplete || this->GetSourceContextInfo(hostSourceContext, nullptr) != nullptr)
+        {
+            return false;
+        }
+
+        SourceDynamicProfileManager * profileManager = SourceDynamicProfileManager::LoadFromBuffer(buffer, length, this->GetRecycler());
+        if (profileManager == nullptr)
+        {
+            return false;
+        }
+
+        if (this->cache->loadedProfileMap == nullptr)
+        {
+            this->cache->loadedProfileMap = RecyclerNew(this->GetRecycler(), SourceDynamicProfileManagerMap, this->GetRecycler());
+        }
+        this->cache->loadedProfileMap->Item(hostSourceContext, profileManager);
+        return true;
+    }
+#endif
+
     // static
     const char16* ScriptContext::CopyString(const char16* str, size_t charCount, ArenaAllocator* alloc)
     {
@@ -4849,6 +4888,12 @@ void ScriptContext::RegisterPrototypeChainEnsuredToHaveOnlyWritableDataPropertie
             {
                 profileInfoList->Prepend(this->GetRecycler(), newDynamicProfileInfo);
             }
+#endif
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+            if (profileManager != nullptr && SourceDynamicProfileManager::NeedSaveDynamicProfileInfo(this))
+            {
+                profileManager->SaveDynamicProfileInfo(functionBody);
+            }
 #endif
             if (!startupComplete)
             {
@@ -5240,6 +5285,7 @@ void ScriptContext::RegisterPrototypeChainEnsuredToHaveOnlyWritableDataPropertie
                 speculativeJitCount, funcJITCount, funcJitCodeUsed, ((float)(funcJitCodeUsed) / funcJITCount) * 100, bytecodeJITCount, jitCodeUsed, ((float)(jitCodeUsed) / bytecodeJITCount) * 100);
             Output::Print(_u("** LoopJITCount: %6d LoopJitCodeUsed: %6d Usage: %f\n"),
                 loopJITCount, loopJitCodeUsed, ((float)loopJitCodeUsed / loopJITCount) * 100);
+            Output::Print(_u("** RegAllocTime: %8d us FastRegAllocFunctions: %6d\n"), regAllocTime, fastRegAllocCount);
             Output::Print(_u("** TotalInterpretedCalls: %6d MaxFuncInterp: %6d  InterpretedHighPri: %6d \n"),
                 interpretedCount, maxFuncInterpret, interpretedCallsHighPri);
             Output::Print(_u("** ZeroInterpretedFunctions: %6d OneInterpretedFunctions: %6d ZeroInterpretedWithNonZeroBytecode: %6d \n "), zeroInterpretedFunctions, oneInterpretedFunctions, nonZeroBytecodeFunctions);
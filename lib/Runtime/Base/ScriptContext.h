@@ -321,6 +321,9 @@ namespace Js
     static const unsigned int EvalMRUSize = 15;
     typedef JsUtil::BaseDictionary<DWORD_PTR, SourceContextInfo *, Recycler, PowerOf2SizePolicy> SourceContextInfoMap;
     typedef JsUtil::BaseDictionary<uint, SourceContextInfo *, Recycler, PowerOf2SizePolicy> DynamicSourceContextInfoMap;
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+    typedef JsUtil::BaseDictionary<DWORD_PTR, SourceDynamicProfileManager *, Recycler, PowerOf2SizePolicy> SourceDynamicProfileManagerMap;
+#endif
 
     typedef JsUtil::BaseDictionary<EvalMapString, ScriptFunction*, RecyclerNonLeafAllocator, PrimeSizePolicy> SecondLevelEvalCache;
     typedef TwoLevelHashRecord<FastEvalMapString, ScriptFunction*, SecondLevelEvalCache, EvalMapString> EvalMapRecord;
@@ -371,6 +374,9 @@ namespace Js
         RegexPatternMruMap *dynamicRegexMap;
         SourceContextInfoMap* sourceContextInfoMap;   // maps host provided context cookie to the URL of the script buffer passed.
         DynamicSourceContextInfoMap* dynamicSourceContextInfoMap;
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+        SourceDynamicProfileManagerMap* loadedProfileMap;   // profiles the host loaded for scripts that haven't been parsed yet, by host context cookie
+#endif
         SourceContextInfo* noContextSourceContextInfo;
         SRCINFO* noContextGlobalSourceInfo;
         SRCINFO const ** moduleSrcInfo;
@@ -637,6 +643,8 @@ public:
         uint jitCodeUsed;
         uint funcJitCodeUsed;
         uint speculativeJitCount;
+        uint regAllocTime;          // microseconds, in-proc JIT only
+        uint fastRegAllocCount;
 #endif
 
 #ifdef REJIT_STATS
@@ -1036,6 +1044,9 @@ private:
         SourceContextInfo * CreateSourceContextInfo(uint hash, DWORD_PTR hostSourceContext);
         SourceContextInfo * CreateSourceContextInfo(DWORD_PTR hostSourceContext, char16 const * url, size_t len,
             IActiveScriptDataCache* profileDataCache, char16 const * sourceMapUrl = nullptr, size_t sourceMapUrlLen = 0);
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+        bool LoadSourceProfile(DWORD_PTR hostSourceContext, __in_bcount(length) char const * buffer, size_t length);
+#endif
 
 #if defined(LEAK_REPORT) || defined(CHECK_MEMORY_LEAK)
         void ClearSourceContextInfoMaps()
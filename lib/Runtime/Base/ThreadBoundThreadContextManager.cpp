@@ -187,6 +187,11 @@ void ThreadBoundThreadContextManager::DestroyAllContextsAndEntries()
         ThreadContextTLSEntry::Delete(entry);
     }
 
+    DestroySharedJobProcessor();
+}
+
+void ThreadBoundThreadContextManager::DestroySharedJobProcessor()
+{
 #if ENABLE_BACKGROUND_JOB_PROCESSOR
     if (s_sharedJobProcessor != NULL)
     {
@@ -211,7 +216,7 @@ JsUtil::JobProcessor * ThreadBoundThreadContextManager::GetSharedJobProcessor()
         if (s_sharedJobProcessor == NULL)
         {
             // We don't need to have allocation policy manager for web worker.
-            s_sharedJobProcessor = HeapNew(JsUtil::BackgroundJobProcessor, NULL, NULL, false /*disableParallelThreads*/);
+            s_sharedJobProcessor = HeapNew(JsUtil::BackgroundJobProcessor, NULL, NULL, false /*disableParallelThreads*/, true /*isShared*/);
         }
     }
 
@@ -221,6 +226,16 @@ JsUtil::JobProcessor * ThreadBoundThreadContextManager::GetSharedJobProcessor()
 #endif
 }
 
+uint ThreadBoundThreadContextManager::GetSharedJobProcessorQueuedJobCount()
+{
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
+    AutoCriticalSection lock(&s_sharedJobProcessorCreationLock);
+    return s_sharedJobProcessor != NULL ? s_sharedJobProcessor->GetQueuedJobCount() : 0;
+#else
+    return 0;
+#endif
+}
+
 void RentalThreadContextManager::DestroyThreadContext(ThreadContext* threadContext)
 {
     ShutdownThreadContext(threadContext);
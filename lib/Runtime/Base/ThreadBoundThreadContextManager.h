@@ -21,7 +21,9 @@ public:
     static void DestroyContextAndEntryForCurrentThread();
     static void DestroyAllContexts();
     static void DestroyAllContextsAndEntries();
+    static void DestroySharedJobProcessor();
     static JsUtil::JobProcessor * GetSharedJobProcessor();
+    static uint GetSharedJobProcessorQueuedJobCount();
 private:
     static EntryList entries;
 #if ENABLE_BACKGROUND_JOB_PROCESSOR
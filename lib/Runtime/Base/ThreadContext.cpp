@@ -107,6 +107,11 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     threadService(threadServiceCallback),
     isOptimizedForManyInstances(Js::Configuration::Global.flags.OptimizeForManyInstances),
     bgJit(Js::Configuration::Global.flags.BgJit),
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    hugePageSegments(false),
+#endif
+    numaAffinity(CONFIG_FLAG(NumaAffinity)),
+    sharedSegmentPool(false),
     pageAllocator(allocationPolicyManager, PageAllocatorType_Thread, Js::Configuration::Global.flags, 0, PageAllocator::DefaultMaxFreePageCount,
         false
 #if ENABLE_BACKGROUND_PAGE_FREEING
@@ -178,6 +183,7 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     codePageAllocators(allocationPolicyManager, ALLOC_XDATA, GetPreReservedVirtualAllocator(), GetCurrentProcess()),
 #endif
     dynamicObjectEnumeratorCacheMap(&HeapAllocator::Instance, 16),
+    jsonStringifyTypeCacheMap(&HeapAllocator::Instance, 16),
     //threadContextFlags(ThreadContextFlagNoFlag),
 #ifdef NTBUILD
     telemetryBlock(&localTelemetryBlock),
@@ -270,6 +276,18 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
 #endif
 
     this->InitAvailableCommit();
+
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    if (CONFIG_FLAG(HugePageSegments))
+    {
+        this->EnableHugePageSegments();
+    }
+#endif
+
+    if (CONFIG_FLAG(SharedSegmentPool))
+    {
+        this->EnableSharedSegmentPool();
+    }
 }
 
 void ThreadContext::InitAvailableCommit()
@@ -743,6 +761,27 @@ Recycler* ThreadContext::EnsureRecycler()
     if (recycler == NULL)
     {
         AutoRecyclerPtr newRecycler(HeapNew(Recycler, GetAllocationPolicyManager(), &pageAllocator, Js::Throw::OutOfMemory, Js::Configuration::Global.flags));
+#if ENABLE_HUGE_PAGE_SEGMENTS
+        if (hugePageSegments)
+        {
+            newRecycler->EnableHugePageSegments();
+        }
+#endif
+        if (sharedSegmentPool)
+        {
+            newRecycler->EnableSharedSegmentPool();
+        }
+        if (numaAffinity)
+        {
+            // The recycler is created lazily on the thread that first uses the runtime
+            DWORD numaNode = AutoSystemInfo::Data.GetCurrentNumaNode();
+            if (CONFIG_FLAG(NumaNode) >= 0)
+            {
+                numaNode = (DWORD)CONFIG_FLAG(NumaNode);
+            }
+            newRecycler->SetPreferredNumaNode(numaNode);
+            pageAllocator.SetPreferredNumaNode(numaNode);
+        }
         newRecycler->Initialize(isOptimizedForManyInstances, &threadService); // use in-thread GC when optimizing for many instances
         newRecycler->SetCollectionWrapper(this);
 
@@ -1372,7 +1411,7 @@ ThreadContext::ForceCleanPropertyMap()
 JsUtil::JobProcessor *
 ThreadContext::GetJobProcessor()
 {
-    if(bgJit && isOptimizedForManyInstances)
+    if(bgJit && (isOptimizedForManyInstances || IsJitThreadPoolShared()))
     {
         return ThreadBoundThreadContextManager::GetSharedJobProcessor();
     }
@@ -1381,7 +1420,7 @@ ThreadContext::GetJobProcessor()
     {
         if(bgJit && !isOptimizedForManyInstances)
         {
-            jobProcessor = HeapNew(JsUtil::BackgroundJobProcessor, GetAllocationPolicyManager(), &threadService, false /*disableParallelThreads*/);
+            jobProcessor = HeapNew(JsUtil::BackgroundJobProcessor, GetAllocationPolicyManager(), &threadService, false /*disableParallelThreads*/, false /*isShared*/);
         }
         else
         {
@@ -1390,6 +1429,21 @@ ThreadContext::GetJobProcessor()
     }
     return jobProcessor;
 }
+
+uint
+ThreadContext::GetQueuedJitJobCount() const
+{
+    // Jobs of this thread context's script contexts that are queued to the job processor or being processed by it
+    uint count = 0;
+    for (Js::ScriptContext *scriptContext = scriptContextList; scriptContext; scriptContext = scriptContext->next)
+    {
+        if (scriptContext->GetNativeCodeGenerator() != nullptr)
+        {
+            count += GetQueuedJobCountNativeCodeGen(scriptContext->GetNativeCodeGenerator());
+        }
+    }
+    return count;
+}
 #endif
 
 void
@@ -2566,6 +2620,7 @@ ThreadContext::PreSweepCallback()
     ClearForInCaches();
 
     this->dynamicObjectEnumeratorCacheMap.Clear();
+    this->jsonStringifyTypeCacheMap.Clear();
 }
 
 void
@@ -4468,6 +4523,19 @@ ThreadContext::AddDynamicObjectEnumeratorCache(Js::DynamicType const * dynamicTy
     this->dynamicObjectEnumeratorCacheMap.Item(dynamicType, cache);
 }
 
+void *
+ThreadContext::GetJSONStringifyTypeCache(Js::DynamicType const * dynamicType)
+{
+    void * data;
+    return this->jsonStringifyTypeCacheMap.TryGetValue(dynamicType, &data)? data : nullptr;
+}
+
+void
+ThreadContext::AddJSONStringifyTypeCache(Js::DynamicType const * dynamicType, void * cache)
+{
+    this->jsonStringifyTypeCacheMap.Item(dynamicType, cache);
+}
+
 InterruptPoller::InterruptPoller(ThreadContext *tc) :
     threadContext(tc),
     lastPollTick(0),
@@ -41,6 +41,8 @@ enum ThreadContextFlags
     ThreadContextFlagCanDisableExecution           = 0x00000001,
     ThreadContextFlagEvalDisabled                  = 0x00000002,
     ThreadContextFlagNoJIT                         = 0x00000004,
+    ThreadContextFlagProfilePersistence            = 0x00000008,
+    ThreadContextFlagSharedJitThreadPool           = 0x00000010,
 };
 
 const int LS_MAX_STACK_SIZE_KB = 300;
@@ -742,6 +744,11 @@ private:
     bool hasCollectionCallBack;
     bool isOptimizedForManyInstances;
     bool bgJit;
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    bool hugePageSegments;
+#endif
+    bool numaAffinity;
+    bool sharedSegmentPool;
 
     // We report library code to profiler only if called directly by user code. Not if called by library implementation.
     bool isProfilingUserCode;
@@ -804,6 +811,7 @@ private:
 
     typedef JsUtil::BaseDictionary<Js::DynamicType const *, void *, HeapAllocator, PowerOf2SizePolicy> DynamicObjectEnumeratorCacheMap;
     DynamicObjectEnumeratorCacheMap dynamicObjectEnumeratorCacheMap;
+    DynamicObjectEnumeratorCacheMap jsonStringifyTypeCacheMap;
 
 #ifdef NTBUILD
     ThreadContextWatsonTelemetryBlock localTelemetryBlock;
@@ -921,6 +929,16 @@ public:
         return this->TestThreadContextFlag(ThreadContextFlagNoJIT);
     }
 
+    bool IsProfilePersistenceEnabled() const
+    {
+        return this->TestThreadContextFlag(ThreadContextFlagProfilePersistence);
+    }
+
+    bool IsJitThreadPoolShared() const
+    {
+        return this->TestThreadContextFlag(ThreadContextFlagSharedJitThreadPool);
+    }
+
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     Js::Var GetMemoryStat(Js::ScriptContext* scriptContext);
     void SetAutoProxyName(LPCWSTR objectName);
@@ -1181,6 +1199,7 @@ public:
 #if ENABLE_NATIVE_CODEGEN
     BOOL IsNativeAddress(void * pCodeAddr);
     JsUtil::JobProcessor *GetJobProcessor();
+    uint GetQueuedJitJobCount() const;
     Js::Var * GetBailOutRegisterSaveSpace() const { return bailOutRegisterSaveSpace; }
     virtual intptr_t GetBailOutRegisterSaveSpaceAddr() const override { return (intptr_t)bailOutRegisterSaveSpace; }
 #if !FLOATVAR
@@ -1582,6 +1601,8 @@ public:
 
     void * GetDynamicObjectEnumeratorCache(Js::DynamicType const * dynamicType);
     void AddDynamicObjectEnumeratorCache(Js::DynamicType const * dynamicType, void * cache);
+    void * GetJSONStringifyTypeCache(Js::DynamicType const * dynamicType);
+    void AddJSONStringifyTypeCache(Js::DynamicType const * dynamicType, void * cache);
 public:
     bool IsScriptActive() const { return isScriptActive; }
     void SetIsScriptActive(bool isActive) { isScriptActive = isActive; }
@@ -1633,6 +1654,46 @@ public:
 
     }
 
+    bool IsSharedSegmentPoolEnabled() const { return sharedSegmentPool; }
+
+    void EnableSharedSegmentPool()
+    {
+        Assert(!recycler); // the recycler's page allocators pick it up when it is created
+        sharedSegmentPool = true;
+        pageAllocator.EnableSharedSegmentPool();
+    }
+
+    bool IsNumaAffinityEnabled() const { return numaAffinity; }
+
+    void EnableNumaAffinity()
+    {
+        Assert(!recycler); // the node is picked when the recycler is created
+        numaAffinity = true;
+    }
+
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    bool IsHugePageSegmentsEnabled() const { return hugePageSegments; }
+
+    void EnableHugePageSegments()
+    {
+        Assert(!recycler); // mode cannot be changed after recycler is created
+        hugePageSegments = true;
+#if ENABLE_NATIVE_CODEGEN
+        codePageAllocators.EnableHugePageSegments();
+#endif
+    }
+
+    // Memory of the hinted segments that the kernel currently backs with huge pages
+    size_t GetHugePageBackedBytes()
+    {
+        size_t byteCount = recycler != nullptr ? recycler->GetHugePageBackedBytes() : 0;
+#if ENABLE_NATIVE_CODEGEN
+        byteCount += codePageAllocators.GetHugePageBackedBytes();
+#endif
+        return byteCount;
+    }
+#endif
+
 #if ENABLE_NATIVE_CODEGEN
     bool IsBgJitEnabled() const { return bgJit; }
 
@@ -7,7 +7,7 @@
 #if ENABLE_NATIVE_CODEGEN
 namespace Js
 {
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
     DynamicProfileInfo::DynamicProfileInfo()
     {
         hasFunctionBody = false;
@@ -1090,8 +1090,6 @@ namespace Js
             Assert(!scriptContext->GetProfileInfoList() || scriptContext->GetProfileInfoList()->Empty() || scriptContext->GetNoContextSourceContextInfo()->nextLocalFunctionId != 0);
             return;
         }
-        DynamicProfileInfo::UpdateSourceDynamicProfileManagers(scriptContext);
-
         scriptContext->GetSourceContextInfoMap()->Map([&](DWORD_PTR dwHostSourceContext, SourceContextInfo * sourceContextInfo)
         {
             if (sourceContextInfo->sourceDynamicProfileManager != nullptr && sourceContextInfo->url != nullptr
@@ -1108,17 +1106,7 @@ namespace Js
         // This function is called to set a function body to the dynamic profile loaded from cache.
         // Need to verify that the function body matches with the profile info
         Assert(this->dynamicProfileFunctionInfo);
-        if (this->dynamicProfileFunctionInfo->paramInfoCount != functionBody->GetProfiledInParamsCount()
-            || this->dynamicProfileFunctionInfo->ldElemInfoCount != functionBody->GetProfiledLdElemCount()
-            || this->dynamicProfileFunctionInfo->stElemInfoCount != functionBody->GetProfiledStElemCount()
-            || this->dynamicProfileFunctionInfo->arrayCallSiteCount != functionBody->GetProfiledArrayCallSiteCount()
-            || this->dynamicProfileFunctionInfo->fldInfoCount != functionBody->GetProfiledFldCount()
-            || this->dynamicProfileFunctionInfo->slotInfoCount != functionBody->GetProfiledSlotCount()
-            || this->dynamicProfileFunctionInfo->callSiteInfoCount != functionBody->GetProfiledCallSiteCount()
-            || this->dynamicProfileFunctionInfo->returnTypeInfoCount != functionBody->GetProfiledReturnTypeCount()
-            || this->dynamicProfileFunctionInfo->loopCount != functionBody->GetLoopCount()
-            || this->dynamicProfileFunctionInfo->switchCount != functionBody->GetProfiledSwitchCount()
-            || this->dynamicProfileFunctionInfo->divCount != functionBody->GetProfiledDivOrRemCount())
+        if (!this->MatchProfileCounts(functionBody))
         {
             // Reject, the dynamic profile information doesn't match the function body
             return false;
@@ -1133,6 +1121,27 @@ namespace Js
         return true;
     }
 
+    bool DynamicProfileInfo::MatchProfileCounts(FunctionBody * functionBody) const
+    {
+        // A profile created for the function body is always sized from it; only a loaded one can differ
+        if (this->dynamicProfileFunctionInfo == nullptr)
+        {
+            return true;
+        }
+
+        return this->dynamicProfileFunctionInfo->paramInfoCount == functionBody->GetProfiledInParamsCount()
+            && this->dynamicProfileFunctionInfo->ldElemInfoCount == functionBody->GetProfiledLdElemCount()
+            && this->dynamicProfileFunctionInfo->stElemInfoCount == functionBody->GetProfiledStElemCount()
+            && this->dynamicProfileFunctionInfo->arrayCallSiteCount == functionBody->GetProfiledArrayCallSiteCount()
+            && this->dynamicProfileFunctionInfo->fldInfoCount == functionBody->GetProfiledFldCount()
+            && this->dynamicProfileFunctionInfo->slotInfoCount == functionBody->GetProfiledSlotCount()
+            && this->dynamicProfileFunctionInfo->callSiteInfoCount == functionBody->GetProfiledCallSiteCount()
+            && this->dynamicProfileFunctionInfo->returnTypeInfoCount == functionBody->GetProfiledReturnTypeCount()
+            && this->dynamicProfileFunctionInfo->loopCount == functionBody->GetLoopCount()
+            && this->dynamicProfileFunctionInfo->switchCount == functionBody->GetProfiledSwitchCount()
+            && this->dynamicProfileFunctionInfo->divCount == functionBody->GetProfiledDivOrRemCount();
+    }
+
     FldInfo * DynamicProfileInfo::GetFldInfo(FunctionBody* functionBody, uint fieldAccessId) const
     {
         Assert(fieldAccessId < functionBody->GetProfiledFldCount());
@@ -1734,26 +1743,25 @@ namespace Js
     }
 #endif
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
 #if DBG_DUMP
-    void BufferWriter::Log(DynamicProfileInfo* info)
+    void BufferWriter::Log(DynamicProfileInfo* info, FunctionBody* functionBody)
     {
-        if (Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase, info->GetFunctionBody()->GetSourceContextId(), info->GetFunctionBody()->GetLocalFunctionId()))
+        if (Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase, functionBody->GetSourceContextId(), functionBody->GetLocalFunctionId()))
         {
             Output::Print(_u("Saving:"));
-            info->Dump(info->GetFunctionBody());
+            info->Dump(functionBody);
         }
     }
 #endif
 
     template <typename T>
-    bool DynamicProfileInfo::Serialize(T * writer)
+    bool DynamicProfileInfo::Serialize(T * writer, FunctionBody * functionBody)
     {
 #if DBG_DUMP
-        writer->Log(this);
+        writer->Log(this, functionBody);
 #endif
 
-        FunctionBody * functionBody = this->GetFunctionBody();
         Js::ArgSlot paramInfoCount = functionBody->GetProfiledInParamsCount();
         if (!writer->Write(functionBody->GetLocalFunctionId())
             || !writer->Write(paramInfoCount)
@@ -2047,26 +2055,8 @@ namespace Js
 
     // Explicit instantiations - to force the compiler to generate these - so they can be referenced from other compilation units.
     template DynamicProfileInfo * DynamicProfileInfo::Deserialize<BufferReader>(BufferReader*, Recycler*, Js::LocalFunctionId *);
-    template bool DynamicProfileInfo::Serialize<BufferSizeCounter>(BufferSizeCounter*);
-    template bool DynamicProfileInfo::Serialize<BufferWriter>(BufferWriter*);
-
-    void DynamicProfileInfo::UpdateSourceDynamicProfileManagers(ScriptContext * scriptContext)
-    {
-        // We don't clear old dynamic data here, because if a function is inlined, it will never go through the
-        // EnsureDynamicProfileThunk and thus not appear in the list. We would want to keep those data as well.
-        // Just save/update the data from function that has execute.
-
-        // That means that the data will never go away, probably not a good policy if this is cached for web page in WININET.
-
-        SListBase<DynamicProfileInfo *> * profileInfoList = scriptContext->GetProfileInfoList();
-        FOREACH_SLISTBASE_ENTRY(DynamicProfileInfo *, info, profileInfoList)
-        {
-            FunctionBody * functionBody = info->GetFunctionBody();
-            SourceDynamicProfileManager * sourceDynamicProfileManager = functionBody->GetSourceContextInfo()->sourceDynamicProfileManager;
-            sourceDynamicProfileManager->SaveDynamicProfileInfo(functionBody->GetLocalFunctionId(), info);
-        }
-        NEXT_SLISTBASE_ENTRY
-    }
+    template bool DynamicProfileInfo::Serialize<BufferSizeCounter>(BufferSizeCounter*, FunctionBody*);
+    template bool DynamicProfileInfo::Serialize<BufferWriter>(BufferWriter*, FunctionBody*);
 #endif
 
 #ifdef RUNTIME_DATA_COLLECTION
@@ -563,16 +563,14 @@ namespace Js
 #if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
         FunctionBody * functionBody; // This will only be populated if NeedProfileInfoList is true
 #endif
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
         // Used by de-serialize
         DynamicProfileInfo();
 
         template <typename T>
         static DynamicProfileInfo * Deserialize(T * reader, Recycler* allocator, Js::LocalFunctionId * functionId);
         template <typename T>
-        bool Serialize(T * writer);
-
-        static void UpdateSourceDynamicProfileManagers(ScriptContext * scriptContext);
+        bool Serialize(T * writer, FunctionBody * functionBody);
 #endif
         static Js::LocalFunctionId const CallSiteMixed = (Js::LocalFunctionId)-1;
         static Js::LocalFunctionId const CallSiteCrossContext = (Js::LocalFunctionId)-2;
@@ -586,6 +584,7 @@ namespace Js
         static Js::SourceId const InvalidSourceId   = (SourceId)-4;
 
         bool MatchFunctionBody(FunctionBody * functionBody);
+        bool MatchProfileCounts(FunctionBody * functionBody) const;
 
         DynamicProfileInfo(FunctionBody * functionBody);
 
@@ -841,7 +840,7 @@ namespace Js
         }
     };
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
     class BufferReader
     {
     public:
@@ -901,7 +900,7 @@ namespace Js
         }
 
 #if DBG_DUMP
-        void Log(DynamicProfileInfo* info) {}
+        void Log(DynamicProfileInfo* info, FunctionBody* functionBody) {}
 #endif
 
         template <typename T>
@@ -926,7 +925,7 @@ namespace Js
         }
 
 #if DBG_DUMP
-        void Log(DynamicProfileInfo* info);
+        void Log(DynamicProfileInfo* info, FunctionBody* functionBody);
 #endif
         template <typename T>
         bool WriteArray(__in_ecount(len) T * data, size_t len)
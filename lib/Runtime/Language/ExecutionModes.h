@@ -21,6 +21,10 @@ EXECUTION_MODE(ProfilingInterpreter)
 //     - Behavior is determined based on the NewSimpleJit flag
 //     - Off: Behave as old simple JIT (does full profiling)
 //     - On: Behave as new simple JIT (does not profile, includes fast paths)
+//     - There is no template JIT tier below it. AsmJsEncoder can stitch per-opcode templates because asm.js byte
+//       code is fully typed and has no inline caches, bailouts or implicit calls. Ordinary byte code would need
+//       its own frame layout and bailout protocol, which amounts to a new backend. The compile time of this tier
+//       is kept down instead by the fast mode of linear scan (FastRegAlloc).
 EXECUTION_MODE(SimpleJit)
 
 // Full JIT (no profiling, self-explanatory)
@@ -2842,6 +2842,11 @@ namespace Js
         }
 #endif
 
+        // Large functions aren't queued for the background JIT here at link. Each is scheduled once it has been
+        // interpreted MinAsmJsInterpreterRunCount times, like any other asm.js function. Queueing them all at link would
+        // compile functions that may never run, and they would compete with the module's hot functions for the JIT threads.
+        // That trade hasn't been measured on any asm.js workload, so it isn't made.
+
         info->SetIsRuntimeProcessed(true);
 
         // create export object
@@ -29,6 +29,13 @@ namespace Js
         {
             if (dynamicProfileInfo->MatchFunctionBody(functionBody))
             {
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+                // Keep the loaded profile in the next save even if the function doesn't run this time (e.g. it only gets inlined)
+                if (SourceDynamicProfileManager::NeedSaveDynamicProfileInfo(functionBody->GetScriptContext()))
+                {
+                    this->SaveDynamicProfileInfo(functionBody);
+                }
+#endif
                 return dynamicProfileInfo;
             }
 
@@ -329,13 +336,54 @@ namespace Js
         return manager;
     }
 
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+
+    bool
+    SourceDynamicProfileManager::NeedSaveDynamicProfileInfo(ScriptContext * scriptContext)
+    {
+        return scriptContext->GetThreadContext()->IsProfilePersistenceEnabled()
 #ifdef DYNAMIC_PROFILE_STORAGE
+            || DynamicProfileStorage::IsEnabled()
+#endif
+            ;
+    }
 
+    //
+    // Records a function whose profile is written by the next save. The profile itself is taken from the
+    // function body at that point, so the DynamicProfileInfo doesn't need to point back to its function.
+    // The function is only weakly referenced; a script that is no longer in use doesn't stay alive for its profile.
+    //
     void
-    SourceDynamicProfileManager::SaveDynamicProfileInfo(LocalFunctionId functionId, DynamicProfileInfo * dynamicProfileInfo)
+    SourceDynamicProfileManager::SaveDynamicProfileInfo(FunctionBody * functionBody)
     {
-        Assert(dynamicProfileInfo->GetFunctionBody()->HasExecutionDynamicProfileInfo());
-        dynamicProfileInfoMap.Item(functionId, dynamicProfileInfo);
+        LocalFunctionId functionId = functionBody->GetLocalFunctionId();
+        RecyclerWeakReference<FunctionBody> * functionBodyWeakRef;
+        if (savedFunctionBodyMap.TryGetValue(functionId, &functionBodyWeakRef) && functionBodyWeakRef->Get() == functionBody)
+        {
+            return;
+        }
+        savedFunctionBodyMap.Item(functionId, recycler->CreateWeakReferenceHandle(functionBody));
+    }
+
+    //
+    // Returns the function to take a saved profile from, or nullptr if the function has been collected
+    // or has no profile that fits it, in which case nothing is written for it.
+    //
+    FunctionBody *
+    SourceDynamicProfileManager::GetSavedFunctionBody(int index) const
+    {
+        FunctionBody * functionBody = this->savedFunctionBodyMap.GetValueAt(index)->Get();
+        if (functionBody == nullptr || !functionBody->HasDynamicProfileInfo())
+        {
+            return nullptr;
+        }
+
+        DynamicProfileInfo * dynamicProfileInfo = functionBody->GetAnyDynamicProfileInfo();
+        if (dynamicProfileInfo == nullptr || !dynamicProfileInfo->MatchProfileCounts(functionBody))
+        {
+            return nullptr;
+        }
+        return functionBody;
     }
 
     template <typename T>
@@ -384,7 +432,7 @@ namespace Js
             {
                 return nullptr;
             }
-            sourceDynamicProfileManager->dynamicProfileInfoMap.Add(functionId, dynamicProfileInfo);
+            sourceDynamicProfileManager->dynamicProfileInfoMap.Item(functionId, dynamicProfileInfo);
         }
         return sourceDynamicProfileManager;
     }
@@ -414,23 +462,30 @@ namespace Js
             }
 #endif
 
+            // Only functions that ran, or matched a loaded profile, this time around are written. We don't drop the
+            // data of a function that was only inlined, as it never goes through the EnsureDynamicProfileThunk.
+            uint profileCount = 0;
+            for (int i = 0; i < this->savedFunctionBodyMap.Count(); i++)
+            {
+                if (this->GetSavedFunctionBody(i) != nullptr)
+                {
+                    profileCount++;
+                }
+            }
+
             size_t bvSize = BVFixed::GetAllocSize(this->startupFunctions->Length()) ;
             if (!writer->WriteArray((char *)this->startupFunctions, bvSize)
-                || !writer->Write(this->dynamicProfileInfoMap.Count()))
+                || !writer->Write(profileCount))
             {
                 return false;
             }
         }
 
-        for (int i = 0; i < this->dynamicProfileInfoMap.Count(); i++)
+        // The same functions are skipped as when counting above; nothing can be collected in between
+        for (int i = 0; i < this->savedFunctionBodyMap.Count(); i++)
         {
-            DynamicProfileInfo * dynamicProfileInfo = this->dynamicProfileInfoMap.GetValueAt(i);
-            if (dynamicProfileInfo == nullptr || !dynamicProfileInfo->HasFunctionBody())
-            {
-                continue;
-            }
-
-            if (!dynamicProfileInfo->Serialize(writer))
+            FunctionBody * functionBody = this->GetSavedFunctionBody(i);
+            if (functionBody != nullptr && !functionBody->GetAnyDynamicProfileInfo()->Serialize(writer, functionBody))
             {
                 return false;
             }
@@ -438,6 +493,149 @@ namespace Js
         return true;
     }
 
+    //
+    // Writes the header that SaveToBuffer puts in front of the profile: a magic value, the engine version
+    // and build hashes, and the size and checksum of the profile that follows.
+    //
+    bool
+    SourceDynamicProfileManager::WriteBufferHeader(char * buffer, uint payloadSize, uint payloadChecksum)
+    {
+        DWORD jscriptMajorVersion;
+        DWORD jscriptMinorVersion;
+        DWORD buildDateHash;
+        DWORD buildTimeHash;
+        if (FAILED(AutoSystemInfo::GetJscriptFileVersion(&jscriptMajorVersion, &jscriptMinorVersion, &buildDateHash, &buildTimeHash)))
+        {
+            return false;
+        }
+
+        BufferWriter writer(buffer, BufferHeaderSize);
+        uint magic = BufferMagic;
+        return writer.Write(magic)
+            && writer.Write(jscriptMajorVersion)
+            && writer.Write(jscriptMinorVersion)
+            && writer.Write(buildDateHash)
+            && writer.Write(buildTimeHash)
+            && writer.Write(payloadSize)
+            && writer.Write(payloadChecksum);
+    }
+
+    //
+    // FNV-1a over the saved profile, so that a buffer truncated or modified after it was saved is rejected.
+    //
+    uint
+    SourceDynamicProfileManager::ComputeBufferChecksum(__in_bcount(length) char const * buffer, size_t length)
+    {
+        uint checksum = 2166136261u;
+        for (size_t i = 0; i < length; i++)
+        {
+            checksum = (checksum ^ (unsigned char)buffer[i]) * 16777619u;
+        }
+        return checksum;
+    }
+
+    //
+    // Loads a profile saved by SaveToBuffer. Returns nullptr if the buffer is from a different engine build or corrupt.
+    //
+    // The checks only catch a buffer that doesn't hold a profile saved by this engine build. Nothing records which
+    // script a profile was saved for, so the host has to hand it back with the same source it was saved from.
+    // A function whose shape doesn't match its profile ignores the profile (see DynamicProfileInfo::MatchFunctionBody),
+    // but a profile for a changed script can still steer the JIT wrong; it is a performance hint, not trusted input.
+    //
+    SourceDynamicProfileManager *
+    SourceDynamicProfileManager::LoadFromBuffer(__in_bcount(length) char const * buffer, size_t length, Recycler* recycler)
+    {
+        DWORD jscriptMajorVersion;
+        DWORD jscriptMinorVersion;
+        DWORD buildDateHash;
+        DWORD buildTimeHash;
+        if (FAILED(AutoSystemInfo::GetJscriptFileVersion(&jscriptMajorVersion, &jscriptMinorVersion, &buildDateHash, &buildTimeHash)))
+        {
+            return nullptr;
+        }
+
+        BufferReader reader(buffer, length);
+        uint magic;
+        DWORD majorVersion;
+        DWORD minorVersion;
+        DWORD dateHash;
+        DWORD timeHash;
+        if (!reader.Read(&magic) || magic != BufferMagic
+            || !reader.Read(&majorVersion) || majorVersion != jscriptMajorVersion
+            || !reader.Read(&minorVersion) || minorVersion != jscriptMinorVersion
+            || !reader.Read(&dateHash) || dateHash != buildDateHash
+            || !reader.Read(&timeHash) || timeHash != buildTimeHash)
+        {
+            OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile load failed. Buffer is from a different engine version.\n"));
+            return nullptr;
+        }
+
+        uint payloadSize;
+        uint payloadChecksum;
+        if (!reader.Read(&payloadSize) || !reader.Read(&payloadChecksum)
+            || payloadSize > length - BufferHeaderSize
+            || ComputeBufferChecksum(buffer + BufferHeaderSize, payloadSize) != payloadChecksum)
+        {
+            OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile load failed. Buffer is corrupt.\n"));
+            return nullptr;
+        }
+
+        // Anything after the profile is padding (see SaveToBuffer)
+        BufferReader payloadReader(buffer + BufferHeaderSize, payloadSize);
+        uint functionCount;
+        if (!payloadReader.Peek(&functionCount) || functionCount > MAX_FUNCTION_COUNT)
+        {
+            return nullptr;
+        }
+
+        return SourceDynamicProfileManager::Deserialize(&payloadReader, recycler);
+    }
+
+    //
+    // Saves the profile of the given source into the buffer, and returns the bytes written.
+    // With no buffer, returns the size the buffer needs to be. Returns 0 if there is nothing to save.
+    //
+    // Functions collected after the size was asked for are no longer saved, so fewer bytes than that can be
+    // written. The rest of the buffer is left as it is; the header records how much of it holds the profile.
+    //
+    size_t
+    SourceDynamicProfileManager::SaveToBuffer(ScriptContext * scriptContext, SourceContextInfo * info, __out_bcount_opt(length) char * buffer, size_t length)
+    {
+        SourceDynamicProfileManager * manager = info->sourceDynamicProfileManager;
+        if (manager == nullptr)
+        {
+            return 0;
+        }
+
+        BufferSizeCounter counter;
+        if (!manager->Serialize(&counter) || counter.GetByteCount() > UINT_MAX)
+        {
+            return 0;
+        }
+
+        size_t byteCount = BufferHeaderSize + counter.GetByteCount();
+        if (buffer == nullptr)
+        {
+            return byteCount;
+        }
+
+        if (length < byteCount)
+        {
+            return 0;
+        }
+
+        // Nothing is allocated while writing, so no function can be collected between the count above and here
+        char * payload = buffer + BufferHeaderSize;
+        BufferWriter writer(payload, counter.GetByteCount());
+        if (!manager->Serialize(&writer)
+            || !WriteBufferHeader(buffer, (uint)counter.GetByteCount(), ComputeBufferChecksum(payload, counter.GetByteCount())))
+        {
+            return 0;
+        }
+        return byteCount;
+    }
+
+#ifdef DYNAMIC_PROFILE_STORAGE
     void
     SourceDynamicProfileManager::SaveToDynamicProfileStorage(char16 const * url)
     {
@@ -471,7 +669,7 @@ namespace Js
 
         DynamicProfileStorage::SaveRecord(url, record);
     }
-
+#endif
 #endif
 };
 #endif
@@ -17,11 +17,16 @@ namespace Js
     //
     // For every source file, an instance of SourceDynamicProfileManager is used to save/load data.
     // It uses the WININET cache to save/load profile data.
+    // JSRT hosts can save/load it as a buffer (see JsSerializeScriptProfile), using DYNAMIC_PROFILE_SERIALIZATION.
     // For testing scenarios enabled using DYNAMIC_PROFILE_STORAGE macro, this can persist the profile info into a file as well.
     class SourceDynamicProfileManager
     {
     public:
-        SourceDynamicProfileManager(Recycler* allocator) : isNonCachableScript(false), cachedStartupFunctions(nullptr), recycler(allocator), dynamicProfileInfoMap(allocator), startupFunctions(nullptr), profileDataCache(nullptr) {}
+        SourceDynamicProfileManager(Recycler* allocator) : isNonCachableScript(false), cachedStartupFunctions(nullptr), recycler(allocator), dynamicProfileInfoMap(allocator),
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+            savedFunctionBodyMap(allocator),
+#endif
+            startupFunctions(nullptr), profileDataCache(nullptr) {}
 
         ExecutionFlags IsFunctionExecuted(Js::LocalFunctionId functionId);
         DynamicProfileInfo * GetDynamicProfileInfo(FunctionBody * functionBody);
@@ -37,18 +42,28 @@ namespace Js
         bool LoadFromProfileCache(IActiveScriptDataCache* profileDataCache, LPCWSTR url);
         IActiveScriptDataCache* GetProfileCache() { return profileDataCache; }
         uint GetStartupFunctionsLength() { return (this->startupFunctions ? this->startupFunctions->Length() : 0); }
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+        static SourceDynamicProfileManager * LoadFromBuffer(__in_bcount(length) char const * buffer, size_t length, Recycler* recycler);
+        static size_t SaveToBuffer(ScriptContext * scriptContext, SourceContextInfo * info, __out_bcount_opt(length) char * buffer, size_t length);
+        static bool NeedSaveDynamicProfileInfo(ScriptContext * scriptContext);
+        void SaveDynamicProfileInfo(FunctionBody * functionBody);
+#endif
 
     private:
         friend class DynamicProfileInfo;
         Recycler* recycler;
 
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
 #ifdef DYNAMIC_PROFILE_STORAGE
-        void SaveDynamicProfileInfo(LocalFunctionId functionId, DynamicProfileInfo * dynamicProfileInfo);
         void SaveToDynamicProfileStorage(char16 const * url);
+#endif
         template <typename T>
         static SourceDynamicProfileManager * Deserialize(T * reader, Recycler* allocator);
         template <typename T>
         bool Serialize(T * writer);
+        FunctionBody * GetSavedFunctionBody(int index) const;
+        static bool WriteBufferHeader(char * buffer, uint payloadSize, uint payloadChecksum);
+        static uint ComputeBufferChecksum(__in_bcount(length) char const * buffer, size_t length);
 #endif
         uint SaveToProfileCache();
         bool ShouldSaveToProfileCache(SourceContextInfo* info) const;
@@ -62,8 +77,15 @@ namespace Js
         BVFixed const * cachedStartupFunctions;      // Bit vector representing functions executed at startup that are loaded from a persistent or in-memory cache
                                                      // It's not modified but used as an input for deferred parsing/bytecodegen
         JsUtil::BaseDictionary<LocalFunctionId, DynamicProfileInfo *, Recycler, PowerOf2SizePolicy> dynamicProfileInfoMap;
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+        JsUtil::BaseDictionary<LocalFunctionId, RecyclerWeakReference<FunctionBody> *, Recycler, PowerOf2SizePolicy> savedFunctionBodyMap;  // Functions whose profile is written on save
+#endif
 
         static const uint MAX_FUNCTION_COUNT = 10000;  // Consider data corrupt if there are more functions than this
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+        static const uint BufferMagic = 0x666f7250;    // "Prof", followed by the engine version and build hashes
+        static const uint BufferHeaderSize = sizeof(uint) + sizeof(DWORD) * 4 + sizeof(uint) * 2;  // ... and the profile's size and checksum
+#endif
 
 #ifdef ENABLE_WININET_PROFILE_DATA_CACHE
         //
@@ -320,13 +320,17 @@ namespace JSON
         {
             stringifySession.CompleteInit(space, tempAlloc);
 
-            Js::DynamicObject* wrapper = scriptContext->GetLibrary()->CreateObject();
-            JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(wrapper));
-            Js::PropertyRecord const * propertyRecord;
-            scriptContext->GetOrAddPropertyRecord(_u(""), 0, &propertyRecord);
-            Js::PropertyId propertyId = propertyRecord->GetPropertyId();
-            Js::JavascriptOperators::InitProperty(wrapper, propertyId, value);
-            result = stringifySession.Str(scriptContext->GetLibrary()->GetEmptyString(), propertyId, wrapper);
+            result = stringifySession.TryStringifyFast(value);
+            if (result == nullptr)
+            {
+                Js::DynamicObject* wrapper = scriptContext->GetLibrary()->CreateObject();
+                JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(wrapper));
+                Js::PropertyRecord const * propertyRecord;
+                scriptContext->GetOrAddPropertyRecord(_u(""), 0, &propertyRecord);
+                Js::PropertyId propertyId = propertyRecord->GetPropertyId();
+                Js::JavascriptOperators::InitProperty(wrapper, propertyId, value);
+                result = stringifySession.Str(scriptContext->GetLibrary()->GetEmptyString(), propertyId, wrapper);
+            }
         }
         END_TEMP_ALLOCATOR(tempAlloc, scriptContext);
 
@@ -961,4 +965,317 @@ namespace JSON
         // By default, optimize for scenario when we don't need to change the inside of the string. That's majority of cases.
         return Js::JSONString::Escape<Js::EscapingOperation_NotEscape>(value);
     }
+
+    // -------- StringifySession fast path ------------//
+    //
+    // Without a replacer function or array and without a gap, serializing plain data - strings, numbers, booleans, null, and
+    // objects and arrays of those - can't call back into script. Such values are written straight into one CompoundString
+    // instead of building a tree of concat strings that is flattened at the end, and the property names of each object type
+    // are quoted once and cached. As soon as something else shows up (a toJSON method, an accessor, a proxy, an array hole,
+    // a cycle) the fast path gives up, and since it has no side effects the caller just serializes the value again the
+    // regular way.
+
+    // Very deep data is left to the regular path
+    static const uint JSONStringifyFastPathMaxDepth = 64;
+
+    Js::JavascriptString* StringifySession::TryStringifyFast(Js::Var value)
+    {
+        if (PHASE_OFF1(Js::JSONStringifyFastPathPhase) || this->replacerType != ReplacerNone || this->gap != nullptr)
+        {
+            return nullptr;
+        }
+
+#if ENABLE_TTD
+        if (scriptContext->GetThreadContext()->IsRuntimeInTTDMode())
+        {
+            return nullptr;
+        }
+#endif
+
+        Js::TypeId typeId = Js::JavascriptOperators::GetTypeId(value);
+        if (typeId != Js::TypeIds_Object && typeId != Js::TypeIds_Array && typeId != Js::TypeIds_NativeIntArray && typeId != Js::TypeIds_NativeFloatArray)
+        {
+            return nullptr;
+        }
+
+        // A toJSON method on Object.prototype or Array.prototype would apply to every object or array
+        Js::JavascriptLibrary* library = scriptContext->GetLibrary();
+        Js::RecyclableObject* objectPrototype = library->GetObjectPrototype();
+        Js::RecyclableObject* arrayPrototype = library->GetArrayPrototype();
+        if (Js::JavascriptOperators::GetTypeId(objectPrototype->GetPrototype()) != Js::TypeIds_Null ||
+            arrayPrototype->GetPrototype() != objectPrototype ||
+            objectPrototype->HasProperty(Js::PropertyIds::toJSON) ||
+            arrayPrototype->HasProperty(Js::PropertyIds::toJSON))
+        {
+            return nullptr;
+        }
+
+        Js::Var stack[JSONStringifyFastPathMaxDepth];
+        this->fastPathStack = stack;
+        Js::CompoundString* result = Js::CompoundString::NewWithCharCapacity(64, library);
+        bool succeeded = StringifyFastValue(value, result, 0);
+        this->fastPathStack = nullptr;
+        return succeeded ? result : nullptr;
+    }
+
+    bool StringifySession::EnterFastPathContainer(Js::Var container, uint depth)
+    {
+        if (depth > JSONStringifyFastPathMaxDepth)
+        {
+            return false;
+        }
+
+        // A cycle is left to the regular path, which throws. Following it here until the depth limit could take
+        // exponential time when the cycle is reachable through several members.
+        for (uint i = 0; i < depth - 1; i++)
+        {
+            if (this->fastPathStack[i] == container)
+            {
+                return false;
+            }
+        }
+        this->fastPathStack[depth - 1] = container;
+        return true;
+    }
+
+    StringifySession::FastPathTypeCache* StringifySession::GetFastPathTypeCache(Js::DynamicObject* object)
+    {
+        Js::DynamicType* type = object->GetDynamicType();
+        ThreadContext* threadContext = scriptContext->GetThreadContext();
+        FastPathTypeCache* cache = (FastPathTypeCache*)threadContext->GetJSONStringifyTypeCache(type);
+        if (cache != nullptr && cache->scriptContext == scriptContext)
+        {
+            return cache;
+        }
+
+        // The property list can only be cached for a locked type, whose properties can't change without the object
+        // changing type
+        if (!type->GetIsLocked() && !type->PrepareForTypeSnapshotEnumeration())
+        {
+            return nullptr;
+        }
+
+        Js::DynamicTypeHandler* typeHandler = type->GetTypeHandler();
+        Assert(typeHandler->IsPathTypeHandler());
+        int propertyCount = typeHandler->GetPropertyCount();
+        cache = RecyclerNewStructPlus(scriptContext->GetRecycler(),
+            propertyCount * sizeof(Js::JavascriptString*) + propertyCount * sizeof(Js::PropertyIndex), FastPathTypeCache);
+        cache->scriptContext = scriptContext;
+        cache->keys = (Js::JavascriptString**)(cache + 1);
+        cache->slotIndexes = (Js::PropertyIndex*)(cache->keys + propertyCount);
+        cache->hasToJSON = false;
+
+        uint count = 0;
+        for (Js::PropertyIndex index = 0; index < propertyCount; index++)
+        {
+            Js::PropertyId propertyId = typeHandler->GetPropertyId(scriptContext, index);
+            if (propertyId == Js::PropertyIds::toJSON)
+            {
+                cache->hasToJSON = true;
+            }
+            if (Js::IsInternalPropertyId(propertyId) || scriptContext->GetPropertyName(propertyId)->IsSymbol())
+            {
+                continue;
+            }
+
+            Js::JavascriptString* propertyName = scriptContext->GetPropertyString(propertyId);
+            cache->keys[count] = Js::JavascriptString::Concat(Quote(propertyName), GetPropertySeparator());
+            cache->slotIndexes[count] = index;
+            count++;
+        }
+        cache->propertyCount = count;
+
+        threadContext->AddJSONStringifyTypeCache(type, cache);
+        return cache;
+    }
+
+    bool StringifySession::StringifyFastValue(Js::Var value, Js::CompoundString* result, uint depth)
+    {
+        switch (Js::JavascriptOperators::GetTypeId(value))
+        {
+        case Js::TypeIds_Undefined:
+        case Js::TypeIds_Symbol:
+            // Only array elements get here, object members with these values are skipped
+        case Js::TypeIds_Null:
+            result->Append(_u("null"));
+            return true;
+
+        case Js::TypeIds_Boolean:
+            if (Js::JavascriptBoolean::FromVar(value)->GetValue())
+            {
+                result->Append(_u("true"));
+            }
+            else
+            {
+                result->Append(_u("false"));
+            }
+            return true;
+
+        case Js::TypeIds_Integer:
+            AppendFastNumber(Js::TaggedInt::ToInt32(value), result);
+            return true;
+
+        case Js::TypeIds_Number:
+            AppendFastNumber(Js::JavascriptNumber::GetValue(value), result);
+            return true;
+
+        case Js::TypeIds_String:
+            AppendFastString(Js::JavascriptString::FromVar(value), result);
+            return true;
+
+        case Js::TypeIds_Object:
+            return StringifyFastObject(Js::DynamicObject::FromVar(value), result, depth + 1);
+
+        case Js::TypeIds_Array:
+        case Js::TypeIds_NativeIntArray:
+        case Js::TypeIds_NativeFloatArray:
+            return StringifyFastArray(Js::JavascriptArray::FromVar(value), result, depth + 1);
+
+        default:
+            // Functions, wrapper objects, dates and everything else may have a toJSON method or need conversions that
+            // can call into script
+            return false;
+        }
+    }
+
+    bool StringifySession::StringifyFastObject(Js::DynamicObject* object, Js::CompoundString* result, uint depth)
+    {
+        // Path type handlers only have enumerable data properties. Objects with indexed properties are left to the regular
+        // path, which orders them before the named ones.
+        if (!EnterFastPathContainer(object, depth) ||
+            object->GetPrototype() != scriptContext->GetLibrary()->GetObjectPrototype() ||
+            !object->GetTypeHandler()->IsPathTypeHandler() ||
+            object->HasObjectArray())
+        {
+            return false;
+        }
+
+        FastPathTypeCache* cache = GetFastPathTypeCache(object);
+        if (cache == nullptr || cache->hasToJSON)
+        {
+            return false;
+        }
+
+        PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
+
+        result->Append(_u('{'));
+        bool isFirstMember = true;
+        for (uint i = 0; i < cache->propertyCount; i++)
+        {
+            Js::Var value = object->GetSlot(cache->slotIndexes[i]);
+            Js::TypeId typeId = Js::JavascriptOperators::GetTypeId(value);
+            if (typeId == Js::TypeIds_Undefined || typeId == Js::TypeIds_Symbol)
+            {
+                continue;
+            }
+
+            if (!isFirstMember)
+            {
+                result->Append(_u(','));
+            }
+            result->Append(cache->keys[i]);
+            if (!StringifyFastValue(value, result, depth))
+            {
+                return false;
+            }
+            isFirstMember = false;
+        }
+        result->Append(_u('}'));
+        return true;
+    }
+
+    bool StringifySession::StringifyFastArray(Js::JavascriptArray* array, Js::CompoundString* result, uint depth)
+    {
+        if (!EnterFastPathContainer(array, depth) ||
+            array->IsCrossSiteObject() ||
+            array->GetPrototype() != scriptContext->GetLibrary()->GetArrayPrototype() ||
+            array->HasProperty(Js::PropertyIds::toJSON))
+        {
+            return false;
+        }
+
+        PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
+
+        // Holes would be looked up on the prototypes, so arrays with holes are left to the regular path
+        Js::TypeId typeId = Js::JavascriptOperators::GetTypeId(array);
+        uint32 length = array->GetLength();
+        result->Append(_u('['));
+        for (uint32 i = 0; i < length; i++)
+        {
+            if (i != 0)
+            {
+                result->Append(_u(','));
+            }
+
+            if (typeId == Js::TypeIds_NativeIntArray)
+            {
+                int32 element;
+                if (!array->DirectGetItemAt(i, &element))
+                {
+                    return false;
+                }
+                AppendFastNumber(element, result);
+            }
+            else if (typeId == Js::TypeIds_NativeFloatArray)
+            {
+                double element;
+                if (!array->DirectGetItemAt(i, &element))
+                {
+                    return false;
+                }
+                AppendFastNumber(element, result);
+            }
+            else
+            {
+                Js::Var element;
+                if (!array->DirectGetItemAt(i, &element) || !StringifyFastValue(element, result, depth))
+                {
+                    return false;
+                }
+            }
+        }
+        result->Append(_u(']'));
+        return true;
+    }
+
+    void StringifySession::AppendFastNumber(double value, Js::CompoundString* result)
+    {
+        if (!Js::NumberUtilities::IsFinite(value))
+        {
+            result->Append(_u("null"));
+            return;
+        }
+
+        int32 intValue;
+        if (Js::JavascriptNumber::TryGetInt32Value(value, &intValue))
+        {
+            const auto ConvertInt32ToString = [](const int32 value, char16 *const buffer, const CharCount charCapacity)
+            {
+                const errno_t err = _ltow_s(value, buffer, charCapacity, 10);
+                Assert(err == 0);
+            };
+            result->Append(intValue, 11, ConvertInt32ToString);
+            return;
+        }
+
+        result->Append(Js::JavascriptNumber::ToStringRadix10(value, scriptContext));
+    }
+
+    void StringifySession::AppendFastString(Js::JavascriptString* value, Js::CompoundString* result)
+    {
+        const char16* sz = value->GetString();
+        const charcount_t length = value->GetLength();
+        for (charcount_t i = 0; i < length; i++)
+        {
+            if (Js::JSONString::NeedsEscape(sz[i]))
+            {
+                result->Append(Quote(value));
+                return;
+            }
+        }
+
+        result->Append(_u('"'));
+        result->Append(value);
+        result->Append(_u('"'));
+    }
 } // namespace JSON
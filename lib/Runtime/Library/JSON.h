@@ -39,7 +39,8 @@ namespace JSON
                 replacerType(ReplacerNone),
                 gap(NULL),
                 indent(0),
-                propertySeparator(NULL)
+                propertySeparator(NULL),
+                fastPathStack(NULL)
         {
             replacer.propertyList.propertyNames = NULL;
             replacer.propertyList.length = 0;
@@ -64,7 +65,27 @@ namespace JSON
         Js::Var Str(Js::JavascriptString* key, Js::PropertyId keyId, Js::Var holder);
         Js::Var Str(uint32 index, Js::Var holder);
 
+        Js::JavascriptString* TryStringifyFast(Js::Var value);
+
     private:
+        // Property names of a plain object type, for the fast path. Cached per type on the thread context.
+        struct FastPathTypeCache
+        {
+            Js::ScriptContext * scriptContext;
+            Js::JavascriptString ** keys;       // quoted property name followed by ':'
+            Js::PropertyIndex * slotIndexes;
+            uint propertyCount;
+            bool hasToJSON;
+        };
+
+        FastPathTypeCache* GetFastPathTypeCache(Js::DynamicObject* object);
+        bool EnterFastPathContainer(Js::Var container, uint depth);
+        bool StringifyFastValue(Js::Var value, Js::CompoundString* result, uint depth);
+        bool StringifyFastObject(Js::DynamicObject* object, Js::CompoundString* result, uint depth);
+        bool StringifyFastArray(Js::JavascriptArray* array, Js::CompoundString* result, uint depth);
+        void AppendFastNumber(double value, Js::CompoundString* result);
+        void AppendFastString(Js::JavascriptString* value, Js::CompoundString* result);
+
         Js::JavascriptString* Quote(Js::JavascriptString* value);
 
         Js::Var StringifyObject(Js::Var value);
@@ -99,6 +120,7 @@ namespace JSON
         Js::JavascriptString* gap;
         uint indent;
         Js::JavascriptString* propertySeparator;     // colon or colon+space
+        Js::Var* fastPathStack;                      // objects and arrays being serialized by the fast path, by depth
         Js::Var StringifySession::StrHelper(Js::JavascriptString* key, Js::Var value, Js::Var holder);
     };
 } // namespace JSON
@@ -42,7 +42,9 @@ namespace JSON
 
     Js::Var JSONParser::Parse(Js::JavascriptString* input)
     {
-        return Parse(input->GetSz(), input->GetLength());
+        const char16* str = input->GetSz();
+        this->inputString = input;
+        return Parse(str, input->GetLength());
     }
 
     Js::Var JSONParser::Walk(Js::JavascriptString* name, Js::PropertyId id, Js::Var holder, uint32 index)
@@ -203,9 +205,16 @@ namespace JSON
 
         case tkStrCon:
             {
-                // will auto-null-terminate the string (as length=len+1)
                 uint len = m_scanner.GetCurrentStringLen();
-                retVal = Js::JavascriptString::NewCopyBuffer(m_scanner.GetCurrentString(), len, scriptContext);
+                if (inputString != nullptr && len >= MIN_SUBSTRING_LENGTH && m_scanner.IsCurrentStringInInput())
+                {
+                    retVal = Js::SubString::New(inputString, m_scanner.GetCurrentStringInputOffset(), len);
+                }
+                else
+                {
+                    // will auto-null-terminate the string (as length=len+1)
+                    retVal = Js::JavascriptString::NewCopyBuffer(m_scanner.GetCurrentString(), len, scriptContext);
+                }
                 Scan();
                 return retVal;
             }
@@ -248,13 +257,16 @@ namespace JSON
 
                 //iterate over the array members, get JSON objects and add them in the pArrayMemberList
                 uint k = 0;
+                JsonShapePrediction shape;
                 while (true)
                 {
                     if(tkRBrack == m_token.tk)
                     {
                         break;
                     }
-                    Js::Var value = ParseObject();
+                    // Objects in an array usually all have the same properties, so each one is expected to have the
+                    // shape of the one before it
+                    Js::Var value = tkLCurly == m_token.tk ? ParseObjectLiteral(&shape) : ParseObject();
                     arrayObj->SetItem(k++, value, Js::PropertyOperation_None);
 
                     // if next token is not a comma consider the end of the array member list.
@@ -273,146 +285,198 @@ namespace JSON
             }
 
         case tkLCurly:
-            {
+            return ParseObjectLiteral(nullptr);
 
-                // Parse an object, "{"name1" : ObjMember1, "name2" : ObjMember2, ...} "
-                if(IsCaching())
-                {
-                    if(!typeCacheList)
-                    {
-                        typeCacheList = Anew(this->arenaAllocator, JsonTypeCacheList, this->arenaAllocator, 8);
-                    }
-                }
+        default:
+            m_scanner.ThrowSyntaxError(JSERR_JsonSyntax);
+        }
+    }
 
-                // first, create the object
-                Js::DynamicObject* object = scriptContext->GetLibrary()->CreateObject();
-                JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(object));
+    Js::Var JSONParser::ParseObjectLiteral(JsonShapePrediction* shape)
+    {
+        // Parse an object, "{"name1" : ObjMember1, "name2" : ObjMember2, ...} "
+        if(IsCaching())
+        {
+            if(!typeCacheList)
+            {
+                typeCacheList = Anew(this->arenaAllocator, JsonTypeCacheList, this->arenaAllocator, 8);
+            }
+        }
+
+        // first, create the object
+        Js::DynamicObject* object = scriptContext->GetLibrary()->CreateObject();
+        JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(object));
 #if ENABLE_DEBUG_CONFIG_OPTIONS
-                if (Js::Configuration::Global.flags.IsEnabled(Js::autoProxyFlag))
-                {
-                    object = DynamicObject::FromVar(JavascriptProxy::AutoProxyWrapper(object));
-                }
+        if (Js::Configuration::Global.flags.IsEnabled(Js::autoProxyFlag))
+        {
+            object = DynamicObject::FromVar(JavascriptProxy::AutoProxyWrapper(object));
+        }
 #endif
 
-                //next token after '{'
-                Scan();
+        //next token after '{'
+        Scan();
 
-                //if empty object "{}" return;
-                if(tkRCurly == m_token.tk)
-                {
-                    Scan();
-                    return object;
-                }
-                JsonTypeCache* previousCache = nullptr;
-                JsonTypeCache* currentCache = nullptr;
-                //parse the list of members
-                while(true)
-                {
-                    // parse a list member:  "name" : ObjMember
-                    // and add it to the object.
+        //if empty object "{}" return;
+        if(tkRCurly == m_token.tk)
+        {
+            Scan();
+            return object;
+        }
+        JsonTypeCache* previousCache = nullptr;
+        JsonTypeCache* currentCache = nullptr;
+        JsonTypeCache* firstCache = nullptr;
+        bool isShapeCached = IsCaching();
 
-                    //pick "name"
-                    if(tkStrCon != m_token.tk)
-                    {
-                        m_scanner.ThrowSyntaxError(JSERR_JsonIllegalChar);
-                    }
+        // Slots the object has room for. It can be more than its type needs once the slots are allocated for the
+        // predicted type up front.
+        int slotCapacity = object->GetTypeHandler()->GetSlotCapacity();
 
-                    // currentStrLength = length w/o null-termination
-                    WCHAR* currentStr = m_scanner.GetCurrentString();
-                    uint currentStrLength = m_scanner.GetCurrentStringLen();
+        //parse the list of members
+        while(true)
+        {
+            // parse a list member:  "name" : ObjMember
+            // and add it to the object.
 
-                    DynamicType* typeWithoutProperty = object->GetDynamicType();
-                    if(IsCaching())
-                    {
-                        if(!previousCache)
-                        {
-                            // This is the first property in the list - see if we have an existing cache for it.
-                            currentCache = typeCacheList->LookupWithKey(Js::HashedCharacterBuffer<WCHAR>(currentStr, currentStrLength), nullptr);
-                        }
-                        if(currentCache && currentCache->typeWithoutProperty == typeWithoutProperty &&
-                            currentCache->propertyRecord->Equals(JsUtil::CharacterBuffer<WCHAR>(currentStr, currentStrLength)))
-                        {
-                            //check and consume ":"
-                            if(Scan() != tkColon )
-                            {
-                                m_scanner.ThrowSyntaxError(JSERR_JsonNoColon);
-                            }
-                            Scan();
-
-                            // Cache all values from currentCache as there is a chance that ParseObject might change the cache
-                            DynamicType* typeWithProperty = currentCache->typeWithProperty;
-                            PropertyId propertyId = currentCache->propertyRecord->GetPropertyId();
-                            PropertyIndex propertyIndex = currentCache->propertyIndex;
-                            previousCache = currentCache;
-                            currentCache = currentCache->next;
-
-                            // fast path for type transition and property set
-                            object->EnsureSlots(typeWithoutProperty->GetTypeHandler()->GetSlotCapacity(),
-                                typeWithProperty->GetTypeHandler()->GetSlotCapacity(), scriptContext, typeWithProperty->GetTypeHandler());
-                            object->ReplaceType(typeWithProperty);
-                            Js::Var value = ParseObject();
-                            object->SetSlot(SetSlotArguments(propertyId, propertyIndex, value));
-
-                            // if the next token is not a comma consider the list of members done.
-                            if (tkComma != m_token.tk)
-                                break;
-                            Scan();
-                            continue;
-                        }
-                    }
+            //pick "name"
+            if(tkStrCon != m_token.tk)
+            {
+                m_scanner.ThrowSyntaxError(JSERR_JsonIllegalChar);
+            }
 
-                    // slow path
-                    Js::PropertyRecord const * propertyRecord;
-                    scriptContext->GetOrAddPropertyRecord(currentStr, currentStrLength, &propertyRecord);
+            // currentStrLength = length w/o null-termination
+            WCHAR* currentStr = m_scanner.GetCurrentString();
+            uint currentStrLength = m_scanner.GetCurrentStringLen();
 
+            DynamicType* typeWithoutProperty = object->GetDynamicType();
+            if(IsCaching())
+            {
+                if(!previousCache)
+                {
+                    // This is the first property in the list. In an array it most likely starts the same transitions as
+                    // the previous object did, otherwise see if we have an existing cache for it.
+                    currentCache = shape != nullptr ? shape->firstCache : nullptr;
+                    if(!currentCache || !currentCache->propertyRecord->Equals(JsUtil::CharacterBuffer<WCHAR>(currentStr, currentStrLength)))
+                    {
+                        currentCache = typeCacheList->LookupWithKey(Js::HashedCharacterBuffer<WCHAR>(currentStr, currentStrLength), nullptr);
+                    }
+                }
+                if(currentCache && currentCache->typeWithoutProperty == typeWithoutProperty &&
+                    currentCache->propertyRecord->Equals(JsUtil::CharacterBuffer<WCHAR>(currentStr, currentStrLength)))
+                {
                     //check and consume ":"
                     if(Scan() != tkColon )
                     {
                         m_scanner.ThrowSyntaxError(JSERR_JsonNoColon);
                     }
                     Scan();
-                    Js::Var value = ParseObject();
-                    PropertyValueInfo info;
-                    object->SetProperty(propertyRecord->GetPropertyId(), value, PropertyOperation_None, &info);
 
-                    DynamicType* typeWithProperty = object->GetDynamicType();
-                    if(IsCaching() && !propertyRecord->IsNumeric() && !info.IsNoCache() && typeWithProperty->GetIsShared() && typeWithProperty->GetTypeHandler()->IsPathTypeHandler())
+                    // Cache all values from currentCache as there is a chance that ParseObject might change the cache
+                    DynamicType* typeWithProperty = currentCache->typeWithProperty;
+                    PropertyId propertyId = currentCache->propertyRecord->GetPropertyId();
+                    PropertyIndex propertyIndex = currentCache->propertyIndex;
+                    if(!previousCache && shape != nullptr && shape->type != nullptr)
                     {
-                        PropertyIndex propertyIndex = info.GetPropertyIndex();
-
-                        if(!previousCache)
+                        // Expect as many properties as the previous object in the array had and allocate the slots for
+                        // all of them now, rather than growing them on the way.
+                        DynamicTypeHandler* predictedTypeHandler = shape->type->GetTypeHandler();
+                        if(predictedTypeHandler->GetSlotCapacity() > slotCapacity &&
+                            predictedTypeHandler->GetInlineSlotCapacity() == typeWithoutProperty->GetTypeHandler()->GetInlineSlotCapacity())
                         {
-                            // This is the first property in the set add it to the dictionary.
-                            currentCache = JsonTypeCache::New(this->arenaAllocator, propertyRecord, typeWithoutProperty, typeWithProperty, propertyIndex);
-                            typeCacheList->AddNew(propertyRecord, currentCache);
+                            object->EnsureSlots(slotCapacity, predictedTypeHandler->GetSlotCapacity(), scriptContext, predictedTypeHandler);
+                            slotCapacity = predictedTypeHandler->GetSlotCapacity();
                         }
-                        else if(!currentCache)
-                        {
-                            currentCache = JsonTypeCache::New(this->arenaAllocator, propertyRecord, typeWithoutProperty, typeWithProperty, propertyIndex);
-                            previousCache->next = currentCache;
-                        }
-                        else
-                        {
-                            // cache miss!!
-                            currentCache->Update(propertyRecord, typeWithoutProperty, typeWithProperty, propertyIndex);
-                        }
-                        previousCache = currentCache;
-                        currentCache = currentCache->next;
+                    }
+                    previousCache = currentCache;
+                    currentCache = currentCache->next;
+                    if(!firstCache)
+                    {
+                        firstCache = previousCache;
                     }
 
+                    // fast path for type transition and property set
+                    DynamicTypeHandler* typeHandlerWithProperty = typeWithProperty->GetTypeHandler();
+                    if(typeHandlerWithProperty->GetSlotCapacity() > slotCapacity ||
+                        typeHandlerWithProperty->GetInlineSlotCapacity() != typeWithoutProperty->GetTypeHandler()->GetInlineSlotCapacity())
+                    {
+                        object->EnsureSlots(typeWithoutProperty->GetTypeHandler()->GetSlotCapacity(),
+                            typeHandlerWithProperty->GetSlotCapacity(), scriptContext, typeHandlerWithProperty);
+                        slotCapacity = typeHandlerWithProperty->GetSlotCapacity();
+                    }
+                    object->ReplaceType(typeWithProperty);
+                    Js::Var value = ParseObject();
+                    object->SetSlot(SetSlotArguments(propertyId, propertyIndex, value));
+
                     // if the next token is not a comma consider the list of members done.
                     if (tkComma != m_token.tk)
                         break;
                     Scan();
+                    continue;
                 }
+            }
 
-                // check  and consume the ending '}"
-                CheckCurrentToken(tkRCurly, JSERR_JsonNoRcurly);
-                return object;
+            // slow path
+            Js::PropertyRecord const * propertyRecord;
+            scriptContext->GetOrAddPropertyRecord(currentStr, currentStrLength, &propertyRecord);
+
+            //check and consume ":"
+            if(Scan() != tkColon )
+            {
+                m_scanner.ThrowSyntaxError(JSERR_JsonNoColon);
             }
+            Scan();
+            Js::Var value = ParseObject();
+            PropertyValueInfo info;
+            object->SetProperty(propertyRecord->GetPropertyId(), value, PropertyOperation_None, &info);
+
+            DynamicType* typeWithProperty = object->GetDynamicType();
+            // If the slots had to grow they were reallocated for exactly what the type needs
+            slotCapacity = typeWithProperty->GetTypeHandler()->GetSlotCapacity();
+            if(IsCaching() && !propertyRecord->IsNumeric() && !info.IsNoCache() && typeWithProperty->GetIsShared() && typeWithProperty->GetTypeHandler()->IsPathTypeHandler())
+            {
+                PropertyIndex propertyIndex = info.GetPropertyIndex();
 
-        default:
-            m_scanner.ThrowSyntaxError(JSERR_JsonSyntax);
+                if(!previousCache)
+                {
+                    // This is the first property in the set add it to the dictionary.
+                    currentCache = JsonTypeCache::New(this->arenaAllocator, propertyRecord, typeWithoutProperty, typeWithProperty, propertyIndex);
+                    typeCacheList->AddNew(propertyRecord, currentCache);
+                }
+                else if(!currentCache)
+                {
+                    currentCache = JsonTypeCache::New(this->arenaAllocator, propertyRecord, typeWithoutProperty, typeWithProperty, propertyIndex);
+                    previousCache->next = currentCache;
+                }
+                else
+                {
+                    // cache miss!!
+                    currentCache->Update(propertyRecord, typeWithoutProperty, typeWithProperty, propertyIndex);
+                }
+                previousCache = currentCache;
+                currentCache = currentCache->next;
+                if(!firstCache)
+                {
+                    firstCache = previousCache;
+                }
+            }
+            else
+            {
+                isShapeCached = false;
+            }
+
+            // if the next token is not a comma consider the list of members done.
+            if (tkComma != m_token.tk)
+                break;
+            Scan();
+        }
+
+        // check  and consume the ending '}"
+        CheckCurrentToken(tkRCurly, JSERR_JsonNoRcurly);
+
+        if(shape != nullptr)
+        {
+            shape->firstCache = isShapeCached ? firstCache : nullptr;
+            shape->type = isShapeCached ? object->GetDynamicType() : nullptr;
         }
+        return object;
     }
 } // namespace JSON
@@ -46,11 +46,20 @@ namespace JSON
     };
 
 
+    // The shape of the previous object in an array: the cached transition for its first property and its final type
+    struct JsonShapePrediction
+    {
+        JsonTypeCache* firstCache;
+        Js::DynamicType* type;
+
+        JsonShapePrediction() : firstCache(nullptr), type(nullptr) {}
+    };
+
     class JSONParser
     {
     public:
         JSONParser(Js::ScriptContext* sc, Js::RecyclableObject* rv) : scriptContext(sc),
-            reviver(rv),  arenaAllocatorObject(nullptr), arenaAllocator(nullptr), typeCacheList(nullptr)
+            reviver(rv),  arenaAllocatorObject(nullptr), arenaAllocator(nullptr), typeCacheList(nullptr), inputString(nullptr)
         {
         };
 
@@ -66,6 +75,7 @@ namespace JSON
         }
 
         Js::Var ParseObject();
+        Js::Var ParseObjectLiteral(JsonShapePrediction* shape);
 
         void CheckCurrentToken(int tk, int wErr)
         {
@@ -87,6 +97,8 @@ namespace JSON
         ArenaAllocator* arenaAllocator;
         typedef JsUtil::BaseDictionary<const Js::PropertyRecord *, JsonTypeCache*, ArenaAllocator, PowerOf2SizePolicy, Js::PropertyRecordStringHashComparer>  JsonTypeCacheList;
         JsonTypeCacheList* typeCacheList;
+        Js::JavascriptString* inputString;  // When set, string values without escapes are substrings of it
         static const int MIN_CACHE_LENGTH = 50; // Use Json type cache only if the JSON string is larger than this constant.
+        static const uint MIN_SUBSTRING_LENGTH = 16; // Shorter string values are copied, a substring wouldn't save anything.
     };
 } // namespace JSON
@@ -5,10 +5,77 @@
 #include "RuntimeLibraryPch.h"
 #include "JSONScanner.h"
 
+#if defined(_M_IX86) || defined(_M_X64)
+#ifdef _WIN32
+#include <emmintrin.h>
+#endif
+#endif
+
 using namespace Js;
 
 namespace JSON
 {
+    // Strings and whitespace make up most of the JSON text, so the runs of characters that need no handling are
+    // skipped 8 at a time with SSE2 where it's available.
+
+    // Returns the first '"', '\\' or control character in [current, end), or end
+    static const char16* SkipPlainStringChars(const char16* current, const char16* end)
+    {
+#if defined(_M_IX86) || defined(_M_X64)
+        const __m128i quote = _mm_set1_epi16(_u('"'));
+        const __m128i backslash = _mm_set1_epi16(_u('\\'));
+        const __m128i lastControlChar = _mm_set1_epi16(0x1F);
+        const __m128i zero = _mm_setzero_si128();
+        while (end - current >= 8)
+        {
+            const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+            // There is no unsigned 16-bit compare; a char is at most 0x1F iff subtracting 0x1F with saturation gives 0
+            const __m128i isControlChar = _mm_cmpeq_epi16(_mm_subs_epu16(chars, lastControlChar), zero);
+            const __m128i isSpecial = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(chars, quote), _mm_cmpeq_epi16(chars, backslash)), isControlChar);
+            DWORD index;
+            if (_BitScanForward(&index, (DWORD)_mm_movemask_epi8(isSpecial)))
+            {
+                return current + index / sizeof(char16);
+            }
+            current += 8;
+        }
+#endif
+        while (current < end && *current != _u('"') && *current != _u('\\') && *current > 0x1F)
+        {
+            current++;
+        }
+        return current;
+    }
+
+    // Returns the first character in [current, end) that isn't JSON whitespace, or end
+    static const char16* SkipWhitespace(const char16* current, const char16* end)
+    {
+#if defined(_M_IX86) || defined(_M_X64)
+        const __m128i space = _mm_set1_epi16(_u(' '));
+        const __m128i tab = _mm_set1_epi16(_u('\t'));
+        const __m128i lineFeed = _mm_set1_epi16(_u('\n'));
+        const __m128i carriageReturn = _mm_set1_epi16(_u('\r'));
+        while (end - current >= 8)
+        {
+            const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+            const __m128i isWhitespace = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi16(chars, space), _mm_cmpeq_epi16(chars, tab)),
+                _mm_or_si128(_mm_cmpeq_epi16(chars, lineFeed), _mm_cmpeq_epi16(chars, carriageReturn)));
+            DWORD index;
+            if (_BitScanForward(&index, ~(DWORD)_mm_movemask_epi8(isWhitespace) & 0xFFFF))
+            {
+                return current + index / sizeof(char16);
+            }
+            current += 8;
+        }
+#endif
+        while (current < end && (*current == _u(' ') || *current == _u('\t') || *current == _u('\n') || *current == _u('\r')))
+        {
+            current++;
+        }
+        return current;
+    }
+
     // -------- Scanner implementation ------------//
     JSONScanner::JSONScanner()
         : inputText(0), inputLen(0), pToken(0), stringBuffer(0), allocator(0), allocatorObject(0),
@@ -56,7 +123,8 @@ namespace JSON
             case '\r':
             case '\n':
             case ' ':
-                //WS - keep looping
+                //WS - skip the rest of the run and keep looping
+                currentChar = SkipWhitespace(currentChar, inputText + inputLen);
                 break;
 
             case '"':
@@ -233,6 +301,15 @@ namespace JSON
 
         while (currentChar < inputText + inputLen)
         {
+            // Characters other than '"', '\\' and control characters are taken as they are
+            const char16* plainStart = currentChar;
+            currentChar = SkipPlainStringChars(currentChar, inputText + inputLen);
+            bulkLength += (uint)(currentChar - plainStart);
+            if (currentChar == inputText + inputLen)
+            {
+                break;
+            }
+
             ch = ReadNextChar();
             int tempHex;
 
@@ -359,8 +436,7 @@ namespace JSON
             }
             else
             {
-                // continue
-                bulkLength++;
+                AssertMsg(false, "SkipPlainStringChars should have stopped only at '\"', '\\' or a control character");
             }
         }
 
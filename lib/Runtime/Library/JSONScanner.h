@@ -24,6 +24,10 @@ namespace JSON
         uint GetCurrentStringLen() { return currentIndex; }
         uint GetScanPosition() { return uint(currentChar - inputText); }
 
+        // A string without escapes isn't copied, it points into the input
+        bool IsCurrentStringInInput() { return currentString >= inputText && currentString < inputText + inputLen; }
+        uint GetCurrentStringInputOffset() { Assert(IsCurrentStringInInput()); return uint(currentString - inputText); }
+
         void __declspec(noreturn) ThrowSyntaxError(int wErr)
         {
             char16 scanPos[16];
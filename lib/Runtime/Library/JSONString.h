@@ -52,6 +52,11 @@ namespace Js
         static const WCHAR escapeMap[128];
         static const BYTE escapeMapCount[128];
     public:
+        static bool NeedsEscape(char16 ch)
+        {
+            return ch < _countof(escapeMap) && escapeMap[ch] != _u('\0');
+        }
+
         template <EscapingOperation op>
         static Js::JavascriptString* Escape(Js::JavascriptString* value, uint start = 0, WritableStringBuffer* outputString = nullptr)
         {
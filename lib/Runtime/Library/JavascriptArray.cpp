@@ -6229,13 +6229,201 @@ Case0:
         }
     }
 
+    // Stable merge sort used once an array is too large for binary insertion sort. As in TimSort, the input is first split
+    // into ascending runs: strictly descending runs are reversed and short runs are extended to a minimum length with binary
+    // insertion. Adjacent runs are then merged pairwise in place, so input that is already sorted, or sorted in reverse,
+    // takes one pass. Each merge copies the shorter of its two runs out to a scratch buffer, which therefore needs to hold
+    // only half of the elements. While a merge is under way some elements are only in the scratch buffer, so if the comparer
+    // throws, the elements being sorted are left incomplete; callers sort a copy that can be dropped in that case.
+    static const uint32 MergeSortMinRunFloor = 32;
+
+    static uint32 mergeSortMinRun(uint32 length)
+    {
+        // Pick a run length in [32, 64] such that length / minRun is a power of two or slightly less, which keeps the merges
+        // balanced
+        uint32 extraBit = 0;
+        while (length >= 2 * MergeSortMinRunFloor)
+        {
+            extraBit |= length & 1;
+            length >>= 1;
+        }
+        return length + extraBit;
+    }
+
+    template <typename T, typename Comparer>
+    static void binaryInsertionSort(__inout_ecount(end) T *elements, uint32 start, uint32 sortedEnd, uint32 end, Comparer &compare)
+    {
+        for (uint32 i = sortedEnd; i < end; i++)
+        {
+            // Find the position after the last element that doesn't compare greater than the value, to keep the sort stable
+            T value = elements[i];
+            uint32 first = start;
+            uint32 last = i;
+            while (first < last)
+            {
+                uint32 middle = first + (last - first) / 2;
+                if (compare(value, elements[middle]) < 0)
+                {
+                    last = middle;
+                }
+                else
+                {
+                    first = middle + 1;
+                }
+            }
+
+            memmove(elements + first + 1, elements + first, (i - first) * sizeof(T));
+            elements[first] = value;
+        }
+    }
+
+    template <typename T, typename Comparer>
+    static void mergeRuns(__inout_ecount(end) T *elements, __out_ecount((end - start) / 2) T *scratch, uint32 start, uint32 middle, uint32 end, Comparer &compare)
+    {
+        // Runs that are already in order relative to each other stay as they are
+        if (!(compare(elements[middle], elements[middle - 1]) < 0))
+        {
+            return;
+        }
+
+        if (middle - start <= end - middle)
+        {
+            // Move the left run out of the way and merge from the front. What remains of the right run is already in place.
+            const uint32 leftLength = middle - start;
+            js_memcpy_s(scratch, leftLength * sizeof(T), elements + start, leftLength * sizeof(T));
+
+            uint32 left = 0;
+            uint32 right = middle;
+            uint32 index = start;
+            while (left < leftLength && right < end)
+            {
+                // Take from the right run only if it's strictly smaller, so equal elements keep their order
+                if (compare(elements[right], scratch[left]) < 0)
+                {
+                    elements[index++] = elements[right++];
+                }
+                else
+                {
+                    elements[index++] = scratch[left++];
+                }
+            }
+
+            js_memcpy_s(elements + index, (leftLength - left) * sizeof(T), scratch + left, (leftLength - left) * sizeof(T));
+        }
+        else
+        {
+            // Move the right run out of the way and merge from the back. What remains of the left run is already in place.
+            const uint32 rightLength = end - middle;
+            js_memcpy_s(scratch, rightLength * sizeof(T), elements + middle, rightLength * sizeof(T));
+
+            uint32 left = middle;
+            uint32 right = rightLength;
+            uint32 index = end;
+            while (left > start && right > 0)
+            {
+                // Take from the left run only if it's strictly greater, so equal elements keep their order
+                if (compare(scratch[right - 1], elements[left - 1]) < 0)
+                {
+                    elements[--index] = elements[--left];
+                }
+                else
+                {
+                    elements[--index] = scratch[--right];
+                }
+            }
+
+            js_memcpy_s(elements + start, right * sizeof(T), scratch, right * sizeof(T));
+        }
+    }
+
+    template <typename T, typename Comparer>
+    static void mergeSort(__inout_ecount(length) T *elements, uint32 length, Recycler *recycler, Comparer compare)
+    {
+        Assert(length > 1);
+
+        const uint32 minRun = mergeSortMinRun(length);
+        uint32 *runEnds = RecyclerNewArrayLeaf(recycler, uint32, length / MergeSortMinRunFloor + 2);
+        uint32 runCount = 0;
+
+        for (uint32 start = 0; start < length;)
+        {
+            uint32 end = start + 1;
+            if (end < length)
+            {
+                if (compare(elements[end], elements[start]) < 0)
+                {
+                    do
+                    {
+                        end++;
+                    } while (end < length && compare(elements[end], elements[end - 1]) < 0);
+                    for (uint32 low = start, high = end - 1; low < high; low++, high--)
+                    {
+                        T temp = elements[low];
+                        elements[low] = elements[high];
+                        elements[high] = temp;
+                    }
+                }
+                else
+                {
+                    do
+                    {
+                        end++;
+                    } while (end < length && compare(elements[end], elements[end - 1]) >= 0);
+                }
+            }
+
+            const uint32 minEnd = min(length, start + minRun);
+            if (end < minEnd)
+            {
+                binaryInsertionSort(elements, start, end, minEnd, compare);
+                end = minEnd;
+            }
+
+            Assert(runCount < length / MergeSortMinRunFloor + 2);
+            runEnds[runCount++] = end;
+            start = end;
+        }
+
+        if (runCount == 1)
+        {
+            return;
+        }
+
+        // A merge copies out at most the shorter of its two runs
+        T *scratch = RecyclerNewArrayZ(recycler, T, length / 2);
+        while (runCount > 1)
+        {
+            uint32 mergedRunCount = 0;
+            uint32 start = 0;
+            for (uint32 run = 0; run < runCount; run += 2)
+            {
+                const uint32 middle = runEnds[run];
+                const uint32 end = run + 1 < runCount ? runEnds[run + 1] : middle;
+                if (end != middle)
+                {
+                    mergeRuns(elements, scratch, start, middle, end, compare);
+                }
+                runEnds[mergedRunCount++] = end;
+                start = end;
+            }
+            runCount = mergedRunCount;
+        }
+    }
+
+    // The cost of memory moves starts to be more expensive than additional comparer calls (given a simple comparer)
+    // for arrays of more than 512 elements.
+    static const uint32 HybridSortMaxInsertionSortLength = 512;
+
+    // Sorts in place. Binary insertion sort only ever reorders the elements, but the merge sort used for longer arrays can
+    // leave some of them out if the comparer throws, so those have to be a copy the caller can drop.
     static void hybridSort(__inout_ecount(length) Var *elements, uint32 length, CompareVarsInfo* compareInfo)
     {
-        // The cost of memory moves starts to be more expensive than additional comparer calls (given a simple comparer)
-        // for arrays of more than 512 elements.
-        if (length > 512)
+        if (length > HybridSortMaxInsertionSortLength)
         {
-            qsort_s(elements, length, sizeof(Var), compareVars, compareInfo);
+            mergeSort(elements, length, compareInfo->scriptContext->GetRecycler(), [compareInfo](const Var &a, const Var &b)
+            {
+                return compareVars(compareInfo, &a, &b);
+            });
             return;
         }
 
@@ -6299,8 +6487,9 @@ Case0:
 
         TryFinally([&]()
         {
-            //The array is a continuous array if there is only one segment
-            if (startSeg->next == nullptr) // Single segment fast path
+            // The array is a continuous array if there is only one segment. A long one sorted with a comparer is merge sorted,
+            // which needs a copy that can be dropped if the comparer throws, so it goes through the copying path below.
+            if (startSeg->next == nullptr && (compFn == nullptr || startSeg->length <= HybridSortMaxInsertionSortLength)) // Single segment fast path
             {
                 if (compFn != nullptr)
                 {
@@ -6433,14 +6622,18 @@ Case0:
             }
         }
 
-        if (count > 0)
+        if (count > 1)
         {
-            SortElements(elements, 0, count - 1);
-
-            for (uint32 i = 0; i < count; ++i)
+            // The string keys are computed once above; sort by them, stably
+            mergeSort(elements, count, scriptContext->GetRecycler(), [](const Element &a, const Element &b)
             {
-                orig[i] = elements[i].Value;
-            }
+                return JavascriptString::strcmp(a.StringValue, b.StringValue);
+            });
+        }
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            orig[i] = elements[i].Value;
         }
 
         for (uint32 i = count + countUndefined; i < *len; ++i)
@@ -6452,22 +6645,6 @@ Case0:
         return countUndefined;
     }
 
-    int __cdecl JavascriptArray::CompareElements(void* context, const void* elem1, const void* elem2)
-    {
-        const Element* element1 = static_cast<const Element*>(elem1);
-        const Element* element2 = static_cast<const Element*>(elem2);
-
-        Assert(element1 != NULL);
-        Assert(element2 != NULL);
-
-        return JavascriptString::strcmp(element1->StringValue, element2->StringValue);
-    }
-
-    void JavascriptArray::SortElements(Element* elements, uint32 left, uint32 right)
-    {
-        qsort_s(elements, right - left + 1, sizeof(Element), CompareElements, this);
-    }
-
     Var JavascriptArray::EntrySort(RecyclableObject* function, CallInfo callInfo, ...)
     {
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
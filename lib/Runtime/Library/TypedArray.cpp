@@ -2261,6 +2261,167 @@ namespace Js
         }
     }
 
+    // Sorting without a comparer doesn't call out to script, so the elements can be sorted by value directly. Each element
+    // is read out as an unsigned key with the same order as the numeric value, the keys are sorted, and mapped back.
+    // Signed integers get their sign bit flipped. Floats get their sign bit set if positive and all their bits flipped if
+    // negative, which orders -0 before +0; every NaN gets the largest key so they all sort last.
+    template<typename KeyType> struct UnsignedSortKey
+    {
+        typedef KeyType Type;
+        static KeyType ToKey(KeyType bits) { return bits; }
+        static KeyType FromKey(KeyType key) { return key; }
+    };
+
+    template<typename KeyType> struct SignedSortKey
+    {
+        typedef KeyType Type;
+        static const KeyType SignBit = (KeyType)1 << (sizeof(KeyType) * 8 - 1);
+        static KeyType ToKey(KeyType bits) { return bits ^ SignBit; }
+        static KeyType FromKey(KeyType key) { return key ^ SignBit; }
+    };
+
+    template<typename KeyType, KeyType InfinityBits> struct FloatSortKey
+    {
+        typedef KeyType Type;
+        static const KeyType SignBit = (KeyType)1 << (sizeof(KeyType) * 8 - 1);
+        static KeyType ToKey(KeyType bits)
+        {
+            if ((bits & ~SignBit) > InfinityBits)
+            {
+                return (KeyType)~(KeyType)0;
+            }
+            return (bits & SignBit) ? (KeyType)~bits : (KeyType)(bits | SignBit);
+        }
+        static KeyType FromKey(KeyType key) { return (key & SignBit) ? (KeyType)(key ^ SignBit) : (KeyType)~key; }
+    };
+
+    template<typename T> struct TypedArraySortKey;
+    template<> struct TypedArraySortKey<int8> : SignedSortKey<uint8> {};
+    template<> struct TypedArraySortKey<uint8> : UnsignedSortKey<uint8> {};
+    template<> struct TypedArraySortKey<bool> : UnsignedSortKey<uint8> {};
+    template<> struct TypedArraySortKey<int16> : SignedSortKey<uint16> {};
+    template<> struct TypedArraySortKey<uint16> : UnsignedSortKey<uint16> {};
+    template<> struct TypedArraySortKey<char16> : UnsignedSortKey<uint16> {};
+    template<> struct TypedArraySortKey<int32> : SignedSortKey<uint32> {};
+    template<> struct TypedArraySortKey<uint32> : UnsignedSortKey<uint32> {};
+    template<> struct TypedArraySortKey<int64> : SignedSortKey<uint64> {};
+    template<> struct TypedArraySortKey<uint64> : UnsignedSortKey<uint64> {};
+    template<> struct TypedArraySortKey<float> : FloatSortKey<uint32, 0x7F800000> {};
+    template<> struct TypedArraySortKey<double> : FloatSortKey<uint64, 0x7FF0000000000000ull> {};
+
+    // Below this length the per-digit passes of the radix sort cost more than an insertion sort
+    static const uint32 TypedArrayRadixSortMinLength = 64;
+
+    template<typename KeyType> static void TypedArraySortKeys(__inout_ecount(length) KeyType* keys, uint32 length, Recycler* recycler)
+    {
+        if (length < TypedArrayRadixSortMinLength)
+        {
+            for (uint32 i = 1; i < length; i++)
+            {
+                KeyType key = keys[i];
+                uint32 j = i;
+                for (; j > 0 && keys[j - 1] > key; j--)
+                {
+                    keys[j] = keys[j - 1];
+                }
+                keys[j] = key;
+            }
+            return;
+        }
+
+        // LSD radix sort, one byte per pass. The histograms for all the bytes are built in a single pass over the keys.
+        const uint DigitCount = sizeof(KeyType);
+        uint32 counts[DigitCount][256];
+        memset(counts, 0, sizeof(counts));
+        for (uint32 i = 0; i < length; i++)
+        {
+            KeyType key = keys[i];
+            for (uint digit = 0; digit < DigitCount; digit++)
+            {
+                counts[digit][(key >> (digit * 8)) & 0xFF]++;
+            }
+        }
+
+        if (DigitCount == 1)
+        {
+            // A single byte is a counting sort; the keys can be written out from the histogram
+            uint32 index = 0;
+            for (uint value = 0; value < 256; value++)
+            {
+                for (uint32 count = counts[0][value]; count > 0; count--)
+                {
+                    keys[index++] = (KeyType)value;
+                }
+            }
+            return;
+        }
+
+        KeyType* source = keys;
+        KeyType* destination = nullptr;
+        for (uint digit = 0; digit < DigitCount; digit++)
+        {
+            const uint shift = digit * 8;
+
+            // Skip the bytes that are the same in every key, which is common for small values in wide types
+            if (counts[digit][(keys[0] >> shift) & 0xFF] == length)
+            {
+                continue;
+            }
+
+            if (destination == nullptr)
+            {
+                destination = RecyclerNewArrayLeaf(recycler, KeyType, length);
+            }
+
+            uint32 offset = 0;
+            for (uint value = 0; value < 256; value++)
+            {
+                uint32 count = counts[digit][value];
+                counts[digit][value] = offset;
+                offset += count;
+            }
+
+            for (uint32 i = 0; i < length; i++)
+            {
+                KeyType key = source[i];
+                destination[counts[digit][(key >> shift) & 0xFF]++] = key;
+            }
+
+            KeyType* temp = source;
+            source = destination;
+            destination = temp;
+        }
+
+        if (source != keys)
+        {
+            js_memcpy_s(keys, length * sizeof(KeyType), source, length * sizeof(KeyType));
+        }
+    }
+
+    template<typename T> void TypedArraySortElementsHelper(void* elements, uint32 length, Recycler* recycler)
+    {
+        typedef TypedArraySortKey<T> SortKey;
+        typedef typename SortKey::Type KeyType;
+        CompileAssert(sizeof(KeyType) == sizeof(T));
+
+        // The keys are sorted in a buffer of their own, and each element is written once, with its final value. The elements
+        // may be in a SharedArrayBuffer, where other agents must never see one holding a key or a stale intermediate value.
+        KeyType localKeys[TypedArrayRadixSortMinLength];
+        KeyType* keys = length <= TypedArrayRadixSortMinLength ? localKeys : RecyclerNewArrayLeaf(recycler, KeyType, length);
+        KeyType* values = static_cast<KeyType*>(elements);
+        for (uint32 i = 0; i < length; i++)
+        {
+            keys[i] = SortKey::ToKey(values[i]);
+        }
+
+        TypedArraySortKeys(keys, length, recycler);
+
+        for (uint32 i = 0; i < length; i++)
+        {
+            values[i] = SortKey::FromKey(keys[i]);
+        }
+    }
+
     Var TypedArrayBase::EntrySort(RecyclableObject* function, CallInfo callInfo, ...)
     {
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
@@ -2293,6 +2454,12 @@ namespace Js
             compareFn = RecyclableObject::FromVar(args[1]);
         }
 
+        if (compareFn == nullptr)
+        {
+            typedArrayBase->GetSortElementsFunction()(typedArrayBase->GetByteBuffer(), length, scriptContext->GetRecycler());
+            return typedArrayBase;
+        }
+
         // Get the elements comparison function for the type of this TypedArray
         void* elementCompare = reinterpret_cast<void*>(typedArrayBase->GetCompareElementsFunction());
 
@@ -2303,7 +2470,7 @@ namespace Js
 
         void * contextToPass[] = { typedArrayBase, compareFn };
 
-        // We can always call qsort_s with the same arguments. If user compareFn is non-null, the callback will use it to do the comparison.
+        // The callback calls the user compareFn to do the comparison.
         qsort_s(typedArrayBase->GetByteBuffer(), length, typedArrayBase->GetBytesPerElement(), elementCompareFunc, contextToPass);
 
 
@@ -11,6 +11,7 @@ namespace Js
     typedef Var (*PFNCreateTypedArray)(Js::ArrayBufferBase* arrayBuffer, uint32 offSet, uint32 mappedLength, Js::JavascriptLibrary* javascriptLibrary);
 
     template<typename T> int __cdecl TypedArrayCompareElementsHelper(void* context, const void* elem1, const void* elem2);
+    template<typename T> void TypedArraySortElementsHelper(void* elements, uint32 length, Recycler* recycler);
 
     class TypedArrayBase : public ArrayBufferParent
     {
@@ -192,6 +193,10 @@ namespace Js
         typedef int(__cdecl* CompareElementsFunction)(void*, const void*, const void*);
         virtual CompareElementsFunction GetCompareElementsFunction() = 0;
 
+        // Sorts the elements in numeric order, used when sort is called without a comparer
+        typedef void(*SortElementsFunction)(void*, uint32, Recycler*);
+        virtual SortElementsFunction GetSortElementsFunction() = 0;
+
         virtual Var Subarray(uint32 begin, uint32 end) = 0;
         int32 BYTES_PER_ELEMENT;
         uint32 byteOffset;
@@ -493,6 +498,11 @@ namespace Js
         {
             return &TypedArrayCompareElementsHelper<TypeName>;
         }
+
+        SortElementsFunction GetSortElementsFunction()
+        {
+            return &TypedArraySortElementsHelper<TypeName>;
+        }
     };
 
     // in windows build environment, char16 is not an intrinsic type, and we cannot do the type
@@ -551,6 +561,11 @@ namespace Js
         {
             return &TypedArrayCompareElementsHelper<char16>;
         }
+
+        SortElementsFunction GetSortElementsFunction()
+        {
+            return &TypedArraySortElementsHelper<char16>;
+        }
     };
 
 #if defined(__clang__)
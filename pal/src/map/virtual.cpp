@@ -36,6 +36,9 @@ Abstract:
 #include <string.h>
 #include <unistd.h>
 #include <limits.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
 
 #if HAVE_VM_ALLOCATE
 #include <mach/vm_map.h>
@@ -105,6 +108,16 @@ static LPVOID ReserveVirtualMemory(
                 IN LPVOID lpAddress,        /* Region to reserve or commit */
                 IN SIZE_T dwSize);          /* Size of Region */
 
+#if defined(__linux__) && defined(MADV_HUGEPAGE) && !MMAP_IGNORES_HINT && !RESERVE_FROM_BACKING_FILE
+#define VIRTUAL_HUGE_PAGES_SUPPORTED 1
+// Size of a PMD-level transparent huge page on x86-64 and arm64 with 4K base pages.
+static const SIZE_T VIRTUAL_HUGE_PAGE_SIZE = 0x200000;
+
+static LPVOID ReserveHugePageAlignedMemory(
+                IN CPalThread *pthrCurrent, /* Currently executing thread */
+                IN SIZE_T dwSize);          /* Size of Region */
+#endif
+
 
 // A memory allocator that allocates memory from a pre-reserved region
 // of virtual memory that is located near the coreclr library.
@@ -810,6 +823,7 @@ static BOOL VIRTUALStoreAllocationInfo(
     pNewEntry->memSize          = memSize;
     pNewEntry->allocationType   = flAllocationType;
     pNewEntry->accessProtection = flProtection;
+    pNewEntry->preferredNode    = NUMA_NO_PREFERRED_NODE;
 
     nBufferSize = memSize / VIRTUAL_PAGE_SIZE / CHAR_BIT;
     if ( ( memSize / VIRTUAL_PAGE_SIZE ) % CHAR_BIT != 0 )
@@ -938,6 +952,15 @@ static LPVOID VIRTUALReserveMemory(
         pRetVal = g_executableMemoryAllocator.AllocateMemory(MemSize);
     }
 
+#if VIRTUAL_HUGE_PAGES_SUPPORTED
+    // Huge page reservations are only aligned when we get to pick the address.
+    // A failure here is not fatal, fall back to a regular reservation.
+    if (pRetVal == NULL && ((flAllocationType & MEM_LARGE_PAGES) != 0) && (lpAddress == NULL))
+    {
+        pRetVal = ReserveHugePageAlignedMemory(pthrCurrent, MemSize);
+    }
+#endif
+
     if (pRetVal == NULL)
     {
         // Try to reserve memory from the OS
@@ -1067,6 +1090,156 @@ done:
     return pRetVal;
 }
 
+/******
+ *
+ *  VIRTUALBindMemoryToNode() - Sets a preferred NUMA node memory policy on a
+ *  committed range, so that pages are allocated from that node on first
+ *  touch when it has free memory. This is only a hint; failures are ignored.
+ *
+ */
+static void VIRTUALBindMemoryToNode(
+                IN LPVOID lpAddress,        /* Committed region */
+                IN SIZE_T dwSize,           /* Size of Region */
+                IN DWORD nndPreferred)      /* NUMA node */
+{
+#if defined(__linux__) && defined(__NR_mbind)
+    // MPOL_PREFERRED from <linux/mempolicy.h>; libnuma is not a dependency.
+    const int VIRTUAL_MPOL_PREFERRED = 1;
+    unsigned long nodeMask = 0;
+
+    if (nndPreferred >= sizeof(nodeMask) * CHAR_BIT)
+    {
+        return;
+    }
+
+    nodeMask = 1UL << nndPreferred;
+    // The kernel expects the mask size in bits, plus one.
+    if (syscall(__NR_mbind, lpAddress, dwSize, VIRTUAL_MPOL_PREFERRED, &nodeMask,
+                sizeof(nodeMask) * CHAR_BIT + 1, 0) != 0)
+    {
+        WARN( "mbind() failed! Error(%d)=%s\n", errno, strerror(errno) );
+    }
+#if defined(_DEBUG) && defined(__NR_get_mempolicy)
+    else
+    {
+        // Check that the range now prefers the node (MPOL_F_ADDR)
+        const unsigned long VIRTUAL_MPOL_F_ADDR = 2;
+        int mode = -1;
+        unsigned long boundNodeMask = 0;
+        if (syscall(__NR_get_mempolicy, &mode, &boundNodeMask, sizeof(boundNodeMask) * CHAR_BIT + 1,
+                    lpAddress, VIRTUAL_MPOL_F_ADDR) == 0)
+        {
+            _ASSERTE(mode == VIRTUAL_MPOL_PREFERRED && boundNodeMask == nodeMask);
+        }
+    }
+#endif
+#endif
+}
+
+#if VIRTUAL_HUGE_PAGES_SUPPORTED
+/******
+ *
+ *  ReserveHugePageAlignedMemory() - Reserves a region that starts on a huge
+ *  page boundary so that the kernel can back it with transparent huge pages
+ *  once it is committed (see VIRTUALCommitMemory).
+ *
+ *      Over-reserves by one huge page and unmaps the unaligned head and tail.
+ *
+ */
+static LPVOID ReserveHugePageAlignedMemory(
+                IN CPalThread *pthrCurrent, /* Currently executing thread */
+                IN SIZE_T dwSize)           /* Size of Region */
+{
+    SIZE_T ReserveSize = dwSize + VIRTUAL_HUGE_PAGE_SIZE - VIRTUAL_PAGE_SIZE;
+    if (ReserveSize < dwSize)
+    {
+        return NULL;
+    }
+
+    LPVOID pRetVal = mmap(NULL, ReserveSize, PROT_NONE, MAP_ANON | MAP_PRIVATE, -1, 0);
+    if (pRetVal == MAP_FAILED)
+    {
+        WARN( "Unable to reserve a huge page aligned region. Error(%d)=%s\n", errno, strerror(errno) );
+        return NULL;
+    }
+
+    UINT_PTR ReserveStart = (UINT_PTR)pRetVal;
+    UINT_PTR ReserveEnd = ReserveStart + ReserveSize;
+    UINT_PTR AlignedStart = (ReserveStart + VIRTUAL_HUGE_PAGE_SIZE - 1) & ~(VIRTUAL_HUGE_PAGE_SIZE - 1);
+    UINT_PTR AlignedEnd = AlignedStart + dwSize;
+
+    if (AlignedStart != ReserveStart)
+    {
+        munmap((LPVOID)ReserveStart, AlignedStart - ReserveStart);
+    }
+    if (ReserveEnd != AlignedEnd)
+    {
+        munmap((LPVOID)AlignedEnd, ReserveEnd - AlignedEnd);
+    }
+
+    return (LPVOID)AlignedStart;
+}
+#endif // VIRTUAL_HUGE_PAGES_SUPPORTED
+
+/******
+ *
+ *  VIRTUALResetMemory() - Helper function that implements MEM_RESET.
+ *
+ *      The pages fully contained in the range are discarded. Unlike Windows,
+ *      where the contents become undefined, the replacement pages read as
+ *      zero: the range stays committed and private anonymous memory is
+ *      zero-filled by the kernel on the next access.
+ *
+ */
+static LPVOID VIRTUALResetMemory(
+                IN CPalThread *pthrCurrent, /* Currently executing thread */
+                IN LPVOID lpAddress,        /* Region to reset */
+                IN SIZE_T dwSize)           /* Size of Region */
+{
+    UINT_PTR StartBoundary;
+    UINT_PTR EndBoundary;
+
+    if ( !lpAddress )
+    {
+        pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
+        return NULL;
+    }
+
+    // Round inward so that no byte outside the requested range is discarded.
+    StartBoundary = ( (UINT_PTR)lpAddress + VIRTUAL_PAGE_MASK ) & ~VIRTUAL_PAGE_MASK;
+    EndBoundary = ( (UINT_PTR)lpAddress + dwSize ) & ~VIRTUAL_PAGE_MASK;
+
+    if ( EndBoundary <= StartBoundary )
+    {
+        return lpAddress;
+    }
+
+#if RESERVE_FROM_BACKING_FILE || MMAP_DOESNOT_ALLOW_REMAP
+    // Discarding a private file mapping would bring back the file contents,
+    // and remapping is not available; zero in place.
+    memset( (LPVOID)StartBoundary, 0, EndBoundary - StartBoundary );
+#elif defined(__linux__)
+    if ( madvise( (LPVOID)StartBoundary, EndBoundary - StartBoundary, MADV_DONTNEED ) != 0 )
+    {
+        ERROR( "madvise() failed! Error(%d)=%s\n", errno, strerror(errno) );
+        pthrCurrent->SetLastError( ERROR_INVALID_ADDRESS );
+        return NULL;
+    }
+#else
+    // MADV_DONTNEED does not guarantee zero-filled pages everywhere; replace
+    // the range with a fresh anonymous mapping instead.
+    if ( mmap( (LPVOID)StartBoundary, EndBoundary - StartBoundary, PROT_WRITE | PROT_READ,
+               MAP_ANON | MAP_FIXED | MAP_PRIVATE, -1, 0 ) == MAP_FAILED )
+    {
+        ERROR( "mmap() failed! Error(%d)=%s\n", errno, strerror(errno) );
+        pthrCurrent->SetLastError( ERROR_INVALID_ADDRESS );
+        return NULL;
+    }
+#endif
+
+    return lpAddress;
+}
+
 /******
  *
  *  VIRTUALCommitMemory() - Helper function that actually commits the memory.
@@ -1233,6 +1406,19 @@ static LPVOID VIRTUALCommitMemory(
                 ERROR("mmap() failed! Error(%d)=%s\n", errno, strerror(errno));
                 goto error;
             }
+#if VIRTUAL_HUGE_PAGES_SUPPORTED
+            // The commit mapping replaces any advice given at reserve time, so
+            // ask for huge pages here. This is only a hint; ignore failures.
+            if ((pInformation->allocationType & MEM_LARGE_PAGES) != 0)
+            {
+                madvise((void *) StartBoundary, MemSize, MADV_HUGEPAGE);
+            }
+#endif
+            // Likewise the memory policy of the new mapping is the default one.
+            if (pInformation->preferredNode != NUMA_NO_PREFERRED_NODE)
+            {
+                VIRTUALBindMemoryToNode((void *) StartBoundary, MemSize, pInformation->preferredNode);
+            }
             VIRTUALSetAllocState(MEM_COMMIT, runStart, runLength, pInformation);
 #if MMAP_DOESNOT_ALLOW_REMAP
             VIRTUALSetDirtyPages (0, runStart, runLength, pInformation);
@@ -1622,12 +1808,73 @@ VirtualAllocEx(
 {
     return VirtualAlloc(lpAddress, dwSize, flAllocationType, flProtect);
 }
+
+/*++
+Function:
+  VirtualAllocExNuma
+
+Note:
+  Only the current process is supported. The preferred node is recorded with
+  the region when it is reserved, and the pages are bound to it as they are
+  committed (see VIRTUALBindMemoryToNode). It has no effect on a commit of an
+  existing region, or on platforms without NUMA memory policies.
+
+See MSDN doc.
+--*/
+LPVOID
+PALAPI
+VirtualAllocExNuma(
+         IN HANDLE hProcess,
+         IN LPVOID lpAddress,       /* Region to reserve or commit */
+         IN SIZE_T dwSize,          /* Size of Region */
+         IN DWORD flAllocationType, /* Type of allocation */
+         IN DWORD flProtect,        /* Type of access protection */
+         IN DWORD nndPreferred)     /* Preferred NUMA node */
+{
+    LPVOID  pRetVal       = NULL;
+    CPalThread *pthrCurrent;
+
+    PERF_ENTRY(VirtualAllocExNuma);
+    ENTRY("VirtualAllocExNuma(hProcess=%p, lpAddress=%p, dwSize=%u, flAllocationType=%#x, \
+          flProtect=%#x, nndPreferred=%u)\n", hProcess, lpAddress, dwSize, flAllocationType, flProtect, nndPreferred);
+
+    pthrCurrent = InternalGetCurrentThread();
+
+    pRetVal = VirtualAlloc(lpAddress, dwSize, flAllocationType, flProtect);
+
+    if ( pRetVal != NULL && nndPreferred != NUMA_NO_PREFERRED_NODE &&
+         ( flAllocationType & MEM_RESERVE ) != 0 )
+    {
+        InternalEnterCriticalSection(pthrCurrent, &virtual_critsec);
+
+        PCMI pInformation = VIRTUALFindRegionInformation( (UINT_PTR)pRetVal );
+        if ( pInformation != NULL )
+        {
+            pInformation->preferredNode = nndPreferred;
+            if ( ( flAllocationType & MEM_COMMIT ) != 0 )
+            {
+                VIRTUALBindMemoryToNode( pRetVal, pInformation->memSize, nndPreferred );
+            }
+        }
+
+        InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
+    }
+
+    LOGEXIT("VirtualAllocExNuma returning %p\n ", pRetVal );
+    PERF_EXIT(VirtualAllocExNuma);
+    return pRetVal;
+}
+
 /*++
 Function:
   VirtualAlloc
 
 Note:
   MEM_TOP_DOWN, MEM_PHYSICAL, MEM_WRITE_WATCH are not supported.
+  MEM_RESET discards the pages; they read back as zero, see VIRTUALResetMemory.
+  MEM_LARGE_PAGES is a transparent huge page hint on MEM_RESERVE: the region is
+  2MB aligned and committed pages are advised with MADV_HUGEPAGE. It needs no
+  privilege and is ignored where transparent huge pages are unavailable.
   Unsupported flags are ignored.
 
   Page size on i386 is set to 4k.
@@ -1657,11 +1904,33 @@ VirtualAlloc(
         goto done;
     }
 
+    if ( ( flAllocationType & MEM_RESET ) != 0 )
+    {
+        if ( flAllocationType != MEM_RESET )
+        {
+            ASSERT( "MEM_RESET cannot be combined with other allocation types.\n" );
+            pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
+            goto done;
+        }
+
+        InternalEnterCriticalSection(pthrCurrent, &virtual_critsec);
+        pRetVal = VIRTUALResetMemory( pthrCurrent, lpAddress, dwSize );
+        InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
+        goto done;
+    }
+
+    if ( ( flAllocationType & MEM_LARGE_PAGES ) != 0 && ( flAllocationType & MEM_RESERVE ) == 0 )
+    {
+        // The hint is recorded with the region when it is reserved.
+        WARN( "Ignoring MEM_LARGE_PAGES without MEM_RESERVE.\n" );
+        flAllocationType &= ~MEM_LARGE_PAGES;
+    }
+
     /* Test for un-supported flags. */
-    if ( ( flAllocationType & ~( MEM_COMMIT | MEM_RESERVE | MEM_TOP_DOWN | MEM_RESERVE_EXECUTABLE ) ) != 0 )
+    if ( ( flAllocationType & ~( MEM_COMMIT | MEM_RESERVE | MEM_TOP_DOWN | MEM_RESERVE_EXECUTABLE | MEM_LARGE_PAGES ) ) != 0 )
     {
         ASSERT( "flAllocationType can be one, or any combination of MEM_COMMIT, \
-               MEM_RESERVE, MEM_TOP_DOWN, or MEM_RESERVE_EXECUTABLE.\n" );
+               MEM_RESERVE, MEM_TOP_DOWN, MEM_RESERVE_EXECUTABLE, or MEM_LARGE_PAGES.\n" );
         pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
         goto done;
     }
@@ -2357,6 +2626,66 @@ ExitVirtualQuery:
     return sizeof( *lpBuffer );
 }
 
+/*++
+Function:
+  PAL_GetHugePageBackedSize
+
+  Returns how many bytes of the given range the kernel currently backs with
+  transparent huge pages, from the AnonHugePages field of /proc/self/smaps.
+  The kernel reports that field per mapping; when a mapping extends past the
+  range, at most the overlapping size is counted. Returns 0 where transparent
+  huge pages are unavailable, or when smaps can't be read.
+
+  This reads and parses smaps, so it is meant for diagnostics, not hot paths.
+--*/
+SIZE_T
+PALAPI
+PAL_GetHugePageBackedSize(
+         IN LPCVOID lpAddress,
+         IN SIZE_T dwSize)
+{
+    SIZE_T HugePageBytes = 0;
+
+    PERF_ENTRY(PAL_GetHugePageBackedSize);
+    ENTRY("PAL_GetHugePageBackedSize(lpAddress=%p, dwSize=%u)\n", lpAddress, dwSize);
+
+#if VIRTUAL_HUGE_PAGES_SUPPORTED
+    UINT_PTR RangeStart = (UINT_PTR)lpAddress;
+    UINT_PTR RangeEnd = RangeStart + dwSize;
+    SIZE_T OverlapSize = 0;
+    FILE * SmapsFile = fopen("/proc/self/smaps", "r");
+
+    if (SmapsFile != NULL)
+    {
+        char Line[256];
+        while (fgets(Line, sizeof(Line), SmapsFile) != NULL)
+        {
+            unsigned long MappingStart;
+            unsigned long MappingEnd;
+            unsigned long AnonHugePagesKB;
+
+            // A mapping header ("start-end perms ...") starts the fields of the next mapping
+            if (sscanf(Line, "%lx-%lx ", &MappingStart, &MappingEnd) == 2)
+            {
+                UINT_PTR OverlapStart = RangeStart > MappingStart ? RangeStart : MappingStart;
+                UINT_PTR OverlapEnd = RangeEnd < MappingEnd ? RangeEnd : MappingEnd;
+                OverlapSize = OverlapStart < OverlapEnd ? OverlapEnd - OverlapStart : 0;
+            }
+            else if (OverlapSize != 0 && sscanf(Line, "AnonHugePages: %lu kB", &AnonHugePagesKB) == 1)
+            {
+                SIZE_T MappingHugePageBytes = (SIZE_T)AnonHugePagesKB * 1024;
+                HugePageBytes += MappingHugePageBytes < OverlapSize ? MappingHugePageBytes : OverlapSize;
+            }
+        }
+        fclose(SmapsFile);
+    }
+#endif
+
+    LOGEXIT("PAL_GetHugePageBackedSize returning %u\n", HugePageBytes);
+    PERF_EXIT(PAL_GetHugePageBackedSize);
+    return HugePageBytes;
+}
+
 /*++
 Function:
   GetWriteWatch
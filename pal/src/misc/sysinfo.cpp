@@ -26,6 +26,7 @@ Revision History:
 #include <sched.h>
 #include <errno.h>
 #include <unistd.h>
+#include <pthread.h>
 #include <sys/types.h>
 #if HAVE_SYSCTL
 #include <sys/sysctl.h>
@@ -326,6 +327,171 @@ PAL_HasGetCurrentProcessorNumber()
     return HAVE_SCHED_GETCPU;
 }
 
+/*++
+Function:
+  GetNumaHighestNodeNumber
+
+  On Linux the highest node comes from the list of online nodes in sysfs
+  ("0", "0-N", or ranges with gaps such as "0,2-3"). Everywhere else, and
+  when sysfs is unavailable, the machine is treated as a single node.
+
+See MSDN doc.
+--*/
+BOOL
+PALAPI
+GetNumaHighestNodeNumber(
+    OUT PULONG HighestNodeNumber)
+{
+    PERF_ENTRY(GetNumaHighestNodeNumber);
+    ENTRY("GetNumaHighestNodeNumber(HighestNodeNumber=%p)\n", HighestNodeNumber);
+
+    *HighestNodeNumber = 0;
+
+#if defined(__linux__)
+    // "possible" also lists nodes that can be hot-added later; only online nodes have memory to prefer
+    FILE * nodeFile = fopen("/sys/devices/system/node/online", "r");
+    if (nodeFile != NULL)
+    {
+        char nodeList[256];
+        if (fgets(nodeList, sizeof(nodeList), nodeFile) != NULL)
+        {
+            char * next = nodeList;
+            while (*next >= '0' && *next <= '9')
+            {
+                ULONG node = (ULONG)strtoul(next, &next, 10);
+                if (node > *HighestNodeNumber)
+                {
+                    *HighestNodeNumber = node;
+                }
+                if (*next == '-' || *next == ',')
+                {
+                    next++;
+                }
+            }
+        }
+        fclose(nodeFile);
+    }
+#endif
+
+    LOGEXIT("GetNumaHighestNodeNumber returns TRUE (%u)\n", *HighestNodeNumber);
+    PERF_EXIT(GetNumaHighestNodeNumber);
+    return TRUE;
+}
+
+// Node of each processor, or 0xFF for processors that don't exist or have no node.
+// Filled once, on first use, by NUMAInitializeProcessorNodes. GetNumaProcessorNode
+// takes a UCHAR, so one entry per value covers every processor it can be asked about;
+// processors past that can't be looked up and are left out.
+static UCHAR s_processorNodes[UCHAR_MAX + 1];
+static pthread_once_t s_processorNodesOnce = PTHREAD_ONCE_INIT;
+
+static void NUMAInitializeProcessorNodes()
+{
+    DWORD processorCount = PAL_GetLogicalCpuCountFromOS();
+#if HAVE_SYSCONF && defined(_SC_NPROCESSORS_CONF)
+    long configuredCount = sysconf(_SC_NPROCESSORS_CONF);
+    if (configuredCount > 0 && (DWORD)configuredCount > processorCount)
+    {
+        processorCount = (DWORD)configuredCount;
+    }
+#endif
+    if (processorCount > UCHAR_MAX + 1)
+    {
+        processorCount = UCHAR_MAX + 1;
+    }
+
+    memset(s_processorNodes, 0xFF, sizeof(s_processorNodes));
+
+#if defined(__linux__)
+    // Each node lists its processors as ranges ("0-3,8-11")
+    ULONG highestNode = 0;
+    GetNumaHighestNodeNumber(&highestNode);
+    bool foundNodes = false;
+    for (ULONG node = 0; node <= highestNode && node < 0xFF; node++)
+    {
+        char path[64];
+        snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", (unsigned int)node);
+        FILE * cpuListFile = fopen(path, "r");
+        if (cpuListFile == NULL)
+        {
+            continue;
+        }
+
+        char cpuList[1024];
+        if (fgets(cpuList, sizeof(cpuList), cpuListFile) != NULL)
+        {
+            foundNodes = true;
+            char * next = cpuList;
+            while (*next >= '0' && *next <= '9')
+            {
+                unsigned long first = strtoul(next, &next, 10);
+                unsigned long last = first;
+                if (*next == '-')
+                {
+                    last = strtoul(next + 1, &next, 10);
+                }
+                for (unsigned long processor = first; processor <= last && processor < processorCount; processor++)
+                {
+                    s_processorNodes[processor] = (UCHAR)node;
+                }
+                if (*next == ',')
+                {
+                    next++;
+                }
+            }
+        }
+        fclose(cpuListFile);
+    }
+
+    if (foundNodes)
+    {
+        return;
+    }
+#endif
+
+    // No NUMA information: every processor is on node 0
+    memset(s_processorNodes, 0, processorCount);
+}
+
+/*++
+Function:
+  GetNumaProcessorNode
+
+  The node of every processor is read once, from sysfs on Linux. Systems
+  without NUMA information report every processor on node 0. Fails, with
+  the node set to 0xFF, for a processor that doesn't exist or has no node.
+
+See MSDN doc.
+--*/
+BOOL
+PALAPI
+GetNumaProcessorNode(
+    IN UCHAR Processor,
+    OUT PUCHAR NodeNumber)
+{
+    BOOL fRetVal = FALSE;
+
+    PERF_ENTRY(GetNumaProcessorNode);
+    ENTRY("GetNumaProcessorNode(Processor=%u, NodeNumber=%p)\n", Processor, NodeNumber);
+
+    *NodeNumber = 0xFF;
+
+    if (pthread_once(&s_processorNodesOnce, NUMAInitializeProcessorNodes) == 0)
+    {
+        *NodeNumber = s_processorNodes[Processor];
+        fRetVal = (*NodeNumber != 0xFF);
+    }
+
+    if (!fRetVal)
+    {
+        SetLastError(ERROR_INVALID_PARAMETER);
+    }
+
+    LOGEXIT("GetNumaProcessorNode returns %d (%u)\n", fRetVal, *NodeNumber);
+    PERF_EXIT(GetNumaProcessorNode);
+    return fRetVal;
+}
+
 DWORD
 PALAPI
 PAL_GetLogicalCpuCountFromOS()
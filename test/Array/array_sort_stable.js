@@ -0,0 +1,129 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Array.prototype.sort is stable for arrays of every length, with and without a comparer. Arrays of more
+// than 512 elements use the merge sort, smaller ones use binary insertion sort.
+
+if (this.WScript && this.WScript.LoadScriptFile) { // Check for running in ch
+    this.WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+}
+
+function makeRecords(length, keyOf) {
+    var records = [];
+    for (var i = 0; i < length; i++) {
+        records.push({ key: keyOf(i), index: i });
+    }
+    return records;
+}
+
+function verifyStable(records, compare, message) {
+    for (var i = 1; i < records.length; i++) {
+        var order = compare(records[i - 1], records[i]);
+        assert.isTrue(order < 0 || (order === 0 && records[i - 1].index < records[i].index), message + " at index " + i);
+    }
+}
+
+function compareKeys(a, b) {
+    return a.key - b.key;
+}
+
+var lengths = [10, 512, 513, 1000, 5000];
+
+var tests = [
+    {
+        name: "Sorting with a comparer keeps equal elements in their original order",
+        body: function () {
+            lengths.forEach(function (length) {
+                var records = makeRecords(length, function (i) { return (i * 7919) % 13; });
+                records.sort(compareKeys);
+                verifyStable(records, compareKeys, "random keys, length " + length);
+            });
+        }
+    },
+    {
+        name: "Ascending, descending and partially sorted input with a comparer",
+        body: function () {
+            lengths.forEach(function (length) {
+                var ascending = makeRecords(length, function (i) { return i >> 3; });
+                ascending.sort(compareKeys);
+                verifyStable(ascending, compareKeys, "ascending, length " + length);
+
+                var descending = makeRecords(length, function (i) { return (length - i) >> 3; });
+                descending.sort(compareKeys);
+                verifyStable(descending, compareKeys, "descending, length " + length);
+
+                var sawtooth = makeRecords(length, function (i) { return i % 100; });
+                sawtooth.sort(compareKeys);
+                verifyStable(sawtooth, compareKeys, "sawtooth, length " + length);
+            });
+        }
+    },
+    {
+        name: "Sorting without a comparer orders by string value and keeps equal strings in order",
+        body: function () {
+            lengths.forEach(function (length) {
+                var records = makeRecords(length, function (i) { return (i * 7919) % 1000; });
+                records.forEach(function (record) {
+                    record.toString = function () { return String(this.key); };
+                });
+                records.sort();
+
+                var compareStrings = function (a, b) {
+                    var x = String(a.key), y = String(b.key);
+                    return x < y ? -1 : (x > y ? 1 : 0);
+                };
+                verifyStable(records, compareStrings, "default comparer, length " + length);
+            });
+        }
+    },
+    {
+        name: "Default sort still puts undefined and holes at the end",
+        body: function () {
+            var array = [];
+            for (var i = 0; i < 1000; i++) {
+                array[i] = (i % 10 === 0) ? undefined : 1000 - i;
+            }
+            array[1500] = 3;
+            array.sort();
+
+            assert.areEqual(1501, array.length, "length is unchanged");
+            assert.areEqual("1", String(array[0]), "smallest string first");
+            assert.areEqual(901, array.filter(function (x) { return x !== undefined; }).length, "defined values are kept");
+            assert.areEqual(undefined, array[901], "undefined values follow the sorted values");
+            assert.isTrue(1000 in array, "last undefined value is present");
+            assert.isFalse(1001 in array, "holes are moved to the end");
+        }
+    },
+    {
+        name: "An exception thrown by the comparer leaves every element in the array",
+        body: function () {
+            // Early failures happen while the runs are built, later ones in the middle of merging them
+            [5000, 14000, 17000].forEach(function (failingCall) {
+                var array = [];
+                for (var i = 0; i < 2000; i++) {
+                    array.push((i * 7919) % 2000);
+                }
+
+                var calls = 0;
+                assert.throws(function () {
+                    array.sort(function (a, b) {
+                        if (++calls === failingCall) {
+                            throw new Error("comparer failed");
+                        }
+                        return a - b;
+                    });
+                }, Error, "comparer exception is propagated", "comparer failed");
+                assert.areEqual(failingCall, calls, "comparer failed on call " + failingCall);
+
+                var copy = array.slice().sort(function (a, b) { return a - b; });
+                for (var i = 0; i < copy.length; i++) {
+                    assert.areEqual(i, copy[i], "element " + i + " is still present after failing on call " + failingCall);
+                }
+            });
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
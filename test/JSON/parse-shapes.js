@@ -0,0 +1,139 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// JSON.parse expects each object in an array to have the properties of the one before it, and sizes its
+// slots for them up front. Objects whose properties differ from that prediction must still come out right.
+
+if (this.WScript && this.WScript.LoadScriptFile) { // Check for running in ch
+    this.WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+}
+
+function record(i, count) {
+    var o = {};
+    for (var j = 0; j < count; j++) {
+        o["field" + j] = j === 0 ? i : "value" + i + "_" + j;
+    }
+    return o;
+}
+
+function verifyRoundTrip(value, message) {
+    var text = JSON.stringify(value);
+    var parsed = JSON.parse(text);
+    assert.areEqual(text, JSON.stringify(parsed), message);
+    return parsed;
+}
+
+var tests = [
+    {
+        name: "Arrays of records with the same properties",
+        body: function () {
+            [1, 2, 3, 4, 5, 8, 9, 16, 17, 33].forEach(function (count) {
+                var records = [];
+                for (var i = 0; i < 50; i++) {
+                    records.push(record(i, count));
+                }
+                var parsed = verifyRoundTrip(records, count + " properties");
+                for (var i = 0; i < parsed.length; i++) {
+                    assert.areEqual(i, parsed[i].field0);
+                    assert.areEqual(count, Object.keys(parsed[i]).length);
+                }
+                parsed[10]["extra"] = 1;
+                parsed[20]["field" + (count - 1)] = "changed";
+                assert.areEqual(1, parsed[10].extra);
+                assert.areEqual("changed", parsed[20]["field" + (count - 1)]);
+                assert.areEqual(JSON.stringify(records[21]), JSON.stringify(parsed[21]));
+            });
+        }
+    },
+    {
+        name: "Records with fewer, more or reordered properties than the previous one",
+        body: function () {
+            var records = [];
+            for (var i = 0; i < 60; i++) {
+                switch (i % 6) {
+                    case 0: records.push(record(i, 10)); break;
+                    case 1: records.push(record(i, 3)); break;
+                    case 2: records.push(record(i, 20)); break;
+                    case 3: records.push({ field1: "b", field0: i, field2: "c" }); break;
+                    case 4: records.push({ other: i, field0: i }); break;
+                    case 5: records.push({}); break;
+                }
+            }
+            var parsed = verifyRoundTrip(records, "mixed shapes");
+            assert.areEqual("field1,field0,field2", Object.keys(parsed[3]).join());
+            assert.areEqual("other,field0", Object.keys(parsed[4]).join());
+            assert.areEqual(0, Object.keys(parsed[5]).length);
+            assert.areEqual(20, Object.keys(parsed[8]).length);
+        }
+    },
+    {
+        name: "Records with the same keys and different value types",
+        body: function () {
+            var text = '[{"a":1,"b":"x","c":null},{"a":"1","b":[1,2],"c":{"d":true}},{"a":1.5,"b":false,"c":[{"a":1},{"a":2}]}]';
+            assert.areEqual(text, JSON.stringify(JSON.parse(text)));
+        }
+    },
+    {
+        name: "Duplicate, numeric and special keys",
+        body: function () {
+            var text = '[{"a":1,"b":2,"a":3},{"a":1,"b":2,"a":3},{"1":"one","a":1,"0":"zero"},{"1":"one","a":1,"0":"zero"},' +
+                '{"__proto__":{"p":1},"a":1},{"__proto__":{"p":2},"a":2},{"":1,"a":2},{"":3,"a":4}]';
+            var parsed = JSON.parse(text);
+            assert.areEqual(3, parsed[0].a);
+            assert.areEqual(3, parsed[1].a);
+            assert.areEqual("a,b", Object.keys(parsed[1]).join());
+            assert.areEqual("0,1,a", Object.keys(parsed[3]).join());
+            assert.areEqual("zero", parsed[3][0]);
+            assert.areEqual(2, parsed[5].__proto__.p);
+            assert.areEqual(Object.prototype, Object.getPrototypeOf(parsed[5]));
+            assert.areEqual(undefined, parsed[5].p);
+            assert.areEqual(3, parsed[7][""]);
+            assert.areEqual(JSON.stringify(parsed), JSON.stringify(JSON.parse(JSON.stringify(parsed))));
+        }
+    },
+    {
+        name: "Nested arrays of records",
+        body: function () {
+            var data = [];
+            for (var i = 0; i < 20; i++) {
+                var children = [];
+                for (var j = 0; j < i % 4; j++) {
+                    children.push({ id: j, name: "child" + j, tags: [{ t: j }, { t: j + 1 }] });
+                }
+                data.push({ id: i, children: children, owner: { id: i, name: "owner" } });
+            }
+            var parsed = verifyRoundTrip({ data: data }, "nested");
+            assert.areEqual(3, parsed.data[7].children[2].tags[1].t);
+        }
+    },
+    {
+        name: "Parsed objects behave like other objects",
+        body: function () {
+            var parsed = JSON.parse('[{"x":1,"y":2,"z":3,"w":4,"v":5},{"x":1,"y":2,"z":3,"w":4,"v":5},{"x":6,"y":7,"z":8,"w":9,"v":10}]');
+            delete parsed[1].y;
+            assert.areEqual("x,z,w,v", Object.keys(parsed[1]).join());
+            Object.defineProperty(parsed[2], "z", { get: function () { return "getter"; } });
+            assert.areEqual("getter", parsed[2].z);
+            for (var i = 0; i < 10; i++) {
+                parsed[0]["added" + i] = i;
+            }
+            assert.areEqual(9, parsed[0].added9);
+            assert.areEqual(5, parsed[0].v);
+            assert.areEqual(10, parsed[2].v);
+        }
+    },
+    {
+        name: "Reviver",
+        body: function () {
+            var text = '[{"a":1,"b":2},{"a":3,"b":4},{"a":5,"b":6}]';
+            var result = JSON.parse(text, function (key, value) {
+                return key === "b" ? undefined : value;
+            });
+            assert.areEqual('[{"a":1},{"a":3},{"a":5}]', JSON.stringify(result));
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
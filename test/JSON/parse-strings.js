@@ -0,0 +1,123 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// The JSON scanner skips runs of plain string characters and whitespace in blocks. Escapes, terminators and
+// invalid characters must be found at every position relative to a block, and long string values without
+// escapes are substrings of the input.
+
+if (this.WScript && this.WScript.LoadScriptFile) { // Check for running in ch
+    this.WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+}
+
+function repeat(s, count) {
+    var result = "";
+    for (var i = 0; i < count; i++) {
+        result += s;
+    }
+    return result;
+}
+
+var tests = [
+    {
+        name: "Escapes at every position",
+        body: function () {
+            var escapes = [["\\\"", "\""], ["\\\\", "\\"], ["\\/", "/"], ["\\n", "\n"], ["\\t", "\t"], ["\\u00e9", "\u00e9"], ["\\ud83d\\ude00", "\ud83d\ude00"]];
+            for (var length = 0; length < 40; length++) {
+                for (var i = 0; i < escapes.length; i++) {
+                    var prefix = repeat("a", length);
+                    var suffix = repeat("b", 40 - length);
+                    assert.areEqual(prefix + escapes[i][1] + suffix, JSON.parse('"' + prefix + escapes[i][0] + suffix + '"'), "escape " + escapes[i][0] + " after " + length + " chars");
+                }
+            }
+        }
+    },
+    {
+        name: "Strings of every length",
+        body: function () {
+            for (var length = 0; length < 70; length++) {
+                var s = repeat("x", length);
+                assert.areEqual(s, JSON.parse('"' + s + '"'));
+                assert.areEqual('["' + s + '",1]', JSON.stringify(JSON.parse('["' + s + '",1]')));
+            }
+        }
+    },
+    {
+        name: "Non-ASCII characters are not mistaken for terminators or control characters",
+        body: function () {
+            var s = "\u0120\u015c\u2020\u3000\u8000\uffff\ud800 \u0080\u007f ";
+            assert.areEqual(repeat(s, 5), JSON.parse('"' + repeat(s, 5) + '"'));
+        }
+    },
+    {
+        name: "Control characters and unterminated strings are rejected at every position",
+        body: function () {
+            for (var length = 0; length < 20; length++) {
+                var prefix = repeat("a", length);
+                assert.throws(function () { JSON.parse('"' + prefix + "\u0001" + 'bbbbbbbbbbbbbbbbbbbb"'); }, SyntaxError);
+                assert.throws(function () { JSON.parse('"' + prefix + "\n" + 'bbbbbbbbbbbbbbbbbbbb"'); }, SyntaxError);
+                assert.throws(function () { JSON.parse('"' + prefix + "\u001f" + '"'); }, SyntaxError);
+                assert.throws(function () { JSON.parse('"' + prefix); }, SyntaxError);
+                assert.throws(function () { JSON.parse('"' + prefix + '\\'); }, SyntaxError);
+            }
+        }
+    },
+    {
+        name: "Whitespace runs of every length",
+        body: function () {
+            var whitespace = " \t\r\n";
+            for (var length = 0; length < 40; length++) {
+                var run = "";
+                for (var i = 0; i < length; i++) {
+                    run += whitespace[i % whitespace.length];
+                }
+                var text = run + "{" + run + '"a"' + run + ":" + run + "[" + run + "1" + run + "," + run + "true" + run + "]" + run + "}" + run;
+                assert.areEqual('{"a":[1,true]}', JSON.stringify(JSON.parse(text)));
+            }
+            assert.throws(function () { JSON.parse("        \u000b  1"); }, SyntaxError);
+            assert.throws(function () { JSON.parse("    \u00a0 1"); }, SyntaxError);
+        }
+    },
+    {
+        name: "Long string values outlive the input and work as property keys",
+        body: function () {
+            var values = [];
+            for (var i = 0; i < 100; i++) {
+                var text = '{"key":"' + repeat("v", 20) + i + '","list":["' + repeat("w", 30) + '","short"]}';
+                var parsed = JSON.parse(text);
+                values.push(parsed.key);
+                assert.areEqual(repeat("w", 30), parsed.list[0]);
+                assert.areEqual("short", parsed.list[1]);
+            }
+            if (typeof CollectGarbage === "function") {
+                CollectGarbage();
+            }
+            for (var i = 0; i < 100; i++) {
+                assert.areEqual(repeat("v", 20) + i, values[i]);
+                var o = {};
+                o[values[i]] = i;
+                assert.areEqual(i, o[repeat("v", 20) + i]);
+                assert.areEqual(20 + String(i).length, values[i].length);
+                assert.areEqual("v" + i, values[i].slice(19));
+            }
+        }
+    },
+    {
+        name: "Reviver sees the same strings",
+        body: function () {
+            var long = repeat("r", 32);
+            var seen = [];
+            var result = JSON.parse('{"a":"' + long + '","b":"x\\ny"}', function (key, value) {
+                if (typeof value === "string") {
+                    seen.push(key + "=" + value);
+                }
+                return value;
+            });
+            assert.areEqual("a=" + long + ",b=x\ny", seen.join(","));
+            assert.areEqual(long, result.a);
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,187 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// JSON.stringify serializes plain objects and arrays directly when there is no replacer and no gap, and falls
+// back to the regular path for anything that could call into script. Both must produce the same output; this
+// test also runs with -off:JSONStringifyFastPath.
+
+if (this.WScript && this.WScript.LoadScriptFile) { // Check for running in ch
+    this.WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+}
+
+function Point(x, y) {
+    this.x = x;
+    this.y = y;
+}
+
+var tests = [
+    {
+        name: "Plain objects and arrays",
+        body: function () {
+            var data = { a: 1, b: "two", c: true, d: false, e: null, f: [1, 2.5, "x", [], {}], g: { h: { i: [null] } } };
+            assert.areEqual('{"a":1,"b":"two","c":true,"d":false,"e":null,"f":[1,2.5,"x",[],{}],"g":{"h":{"i":[null]}}}', JSON.stringify(data));
+            assert.areEqual('[{"a":1},{"a":2},{"a":3}]', JSON.stringify([{ a: 1 }, { a: 2 }, { a: 3 }]));
+            assert.areEqual('{}', JSON.stringify({}));
+            assert.areEqual('[]', JSON.stringify([]));
+        }
+    },
+    {
+        name: "Objects sharing a type and objects whose type changes between calls",
+        body: function () {
+            var points = [];
+            for (var i = 0; i < 5; i++) {
+                points.push({ x: i, y: -i });
+            }
+            assert.areEqual('[{"x":0,"y":0},{"x":1,"y":-1},{"x":2,"y":-2},{"x":3,"y":-3},{"x":4,"y":-4}]', JSON.stringify(points));
+
+            var o = { x: 1, y: 2 };
+            assert.areEqual('{"x":1,"y":2}', JSON.stringify(o));
+            o.z = 3;
+            assert.areEqual('{"x":1,"y":2,"z":3}', JSON.stringify(o));
+            delete o.y;
+            assert.areEqual('{"x":1,"z":3}', JSON.stringify(o));
+            Object.defineProperty(o, "x", { enumerable: false });
+            assert.areEqual('{"z":3}', JSON.stringify(o));
+        }
+    },
+    {
+        name: "Numbers",
+        body: function () {
+            assert.areEqual('[0,0,-1,2147483647,-2147483648,2147483648,0.1,1e+21,1.5e-7,null,null,null]',
+                JSON.stringify([0, -0, -1, 2147483647, -2147483648, 2147483648, 0.1, 1e21, 1.5e-7, NaN, Infinity, -Infinity]));
+            assert.areEqual('{"a":0,"b":null,"c":-0.5}', JSON.stringify({ a: -0, b: NaN, c: -0.5 }));
+        }
+    },
+    {
+        name: "Native int and float arrays",
+        body: function () {
+            var ints = [1, -2, 3, 2147483647];
+            var floats = [1.5, -0, NaN, 3];
+            assert.areEqual('[1,-2,3,2147483647]', JSON.stringify(ints));
+            assert.areEqual('[1.5,0,null,3]', JSON.stringify(floats));
+            assert.areEqual('{"i":[1,-2,3,2147483647],"f":[1.5,0,null,3]}', JSON.stringify({ i: ints, f: floats }));
+        }
+    },
+    {
+        name: "Strings that need escaping",
+        body: function () {
+            assert.areEqual('["plain","q\\"uote","back\\\\slash","new\\nline","\\u0001","\u2028\u00e9"]',
+                JSON.stringify(["plain", "q\"uote", "back\\slash", "new\nline", "\u0001", "\u2028\u00e9"]));
+            var o = {};
+            o["ke\"y"] = "v\tal";
+            assert.areEqual('{"ke\\"y":"v\\tal"}', JSON.stringify(o));
+        }
+    },
+    {
+        name: "Undefined, function and symbol values",
+        body: function () {
+            var data = { a: undefined, b: function () { }, c: Symbol("c"), d: 1 };
+            data[Symbol("e")] = 2;
+            assert.areEqual('{"d":1}', JSON.stringify(data));
+            assert.areEqual('[null,null,null,1]', JSON.stringify([undefined, function () { }, Symbol("c"), 1]));
+            assert.areEqual('{}', JSON.stringify({ a: undefined }));
+        }
+    },
+    {
+        name: "Constructed objects, indexed properties and wrapper objects",
+        body: function () {
+            assert.areEqual('[{"x":1,"y":2}]', JSON.stringify([new Point(1, 2)]));
+            assert.areEqual('{"1":"b","2":"c","a":"a"}', JSON.stringify({ a: "a", 2: "c", 1: "b" }));
+            assert.areEqual('[1,"s",true]', JSON.stringify([new Number(1), new String("s"), new Boolean(true)]));
+            assert.areEqual('{"d":"1970-01-01T00:00:00.000Z"}', JSON.stringify({ d: new Date(0) }));
+        }
+    },
+    {
+        name: "Getters and toJSON methods are called",
+        body: function () {
+            var calls = 0;
+            var withGetter = { a: 1, get b() { calls++; return 2; } };
+            assert.areEqual('{"o":{"a":1,"b":2}}', JSON.stringify({ o: withGetter }));
+            assert.areEqual(1, calls);
+
+            assert.areEqual('{"a":"own"}', JSON.stringify({ a: { toJSON: function () { return "own"; } } }));
+
+            var array = [1, 2];
+            array.toJSON = function () { return "array"; };
+            assert.areEqual('{"a":"array"}', JSON.stringify({ a: array }));
+
+            Object.prototype.toJSON = function () { return "object"; };
+            try {
+                assert.areEqual('"object"', JSON.stringify({ a: 1 }));
+                assert.areEqual('"object"', JSON.stringify([{ a: 1 }]));
+            } finally {
+                delete Object.prototype.toJSON;
+            }
+
+            Array.prototype.toJSON = function () { return "array"; };
+            try {
+                assert.areEqual('{"a":"array"}', JSON.stringify({ a: [1] }));
+            } finally {
+                delete Array.prototype.toJSON;
+            }
+            assert.areEqual('{"a":[1]}', JSON.stringify({ a: [1] }));
+        }
+    },
+    {
+        name: "Array holes and inherited elements",
+        body: function () {
+            assert.areEqual('[1,null,3]', JSON.stringify([1, , 3]));
+            var ints = [1, 2, 3];
+            ints.length = 5;
+            assert.areEqual('[1,2,3,null,null]', JSON.stringify(ints));
+
+            Array.prototype[1] = "inherited";
+            try {
+                assert.areEqual('[1,"inherited",3]', JSON.stringify([1, , 3]));
+            } finally {
+                delete Array.prototype[1];
+            }
+        }
+    },
+    {
+        name: "Objects with a different prototype and proxies",
+        body: function () {
+            var proto = { toJSON: function () { return "proto"; } };
+            assert.areEqual('["proto"]', JSON.stringify([Object.create(proto)]));
+            assert.areEqual('{"a":1}', JSON.stringify(Object.assign(Object.create(null), { a: 1 })));
+            assert.areEqual('[{"a":1}]', JSON.stringify([new Proxy({ a: 1 }, {})]));
+        }
+    },
+    {
+        name: "Cycles throw and deep nesting is serialized",
+        body: function () {
+            var cyclic = { a: {} };
+            cyclic.a.b = cyclic;
+            assert.throws(function () { JSON.stringify(cyclic); }, TypeError);
+
+            var cyclicArray = [1];
+            cyclicArray.push([cyclicArray]);
+            assert.throws(function () { JSON.stringify(cyclicArray); }, TypeError);
+
+            var branching = [];
+            branching.push(branching, branching, { a: branching });
+            assert.throws(function () { JSON.stringify(branching); }, TypeError);
+
+            var deep = {};
+            var expected = "{}";
+            for (var i = 0; i < 100; i++) {
+                deep = { d: deep, i: i };
+                expected = '{"d":' + expected + ',"i":' + i + '}';
+            }
+            assert.areEqual(expected, JSON.stringify(deep));
+        }
+    },
+    {
+        name: "A replacer or a gap uses the regular path",
+        body: function () {
+            var data = { a: 1, b: [1, 2] };
+            assert.areEqual('{"a":1}', JSON.stringify(data, ["a"]));
+            assert.areEqual('{"a":2,"b":[2,4]}', JSON.stringify(data, function (k, v) { return typeof v === "number" ? v * 2 : v; }));
+            assert.areEqual('{\n "a": 1,\n "b": [\n  1,\n  2\n ]\n}', JSON.stringify(data, null, 1));
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
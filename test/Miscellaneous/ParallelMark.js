@@ -0,0 +1,109 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Collects a large, unevenly shaped object graph with parallel mark forced on. Long chains leave one mark
+// thread with most of the work and the others take it over chunk by chunk; everything reachable must survive.
+
+if (this.WScript && this.WScript.LoadScriptFile) { // Check for running in ch
+    this.WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+}
+
+function collect() {
+    if (typeof CollectGarbage === "function") {
+        CollectGarbage();
+    }
+}
+
+function makeChain(length, tag) {
+    var head = null;
+    for (var i = 0; i < length; i++) {
+        head = { next: head, index: i, tag: tag };
+    }
+    return head;
+}
+
+function verifyChain(head, length, tag) {
+    var count = 0;
+    for (var node = head; node !== null; node = node.next) {
+        assert.areEqual(length - 1 - count, node.index);
+        assert.areEqual(tag, node.tag);
+        count++;
+    }
+    assert.areEqual(length, count);
+}
+
+function makeTree(depth, width) {
+    if (depth === 0) {
+        return { leaf: true, values: [depth, width] };
+    }
+    var children = [];
+    for (var i = 0; i < width; i++) {
+        children.push(makeTree(depth - 1, width));
+    }
+    return { leaf: false, children: children };
+}
+
+function countLeaves(tree) {
+    if (tree.leaf) {
+        return 1;
+    }
+    var count = 0;
+    for (var i = 0; i < tree.children.length; i++) {
+        count += countLeaves(tree.children[i]);
+    }
+    return count;
+}
+
+var tests = [
+    {
+        name: "Long chains survive parallel mark",
+        body: function () {
+            var chains = [makeChain(200000, "a"), makeChain(10, "b"), makeChain(50000, "c")];
+            for (var i = 0; i < 3; i++) {
+                collect();
+                verifyChain(chains[0], 200000, "a");
+                verifyChain(chains[1], 10, "b");
+                verifyChain(chains[2], 50000, "c");
+            }
+        }
+    },
+    {
+        name: "Wide trees and chains together, with garbage created between collections",
+        body: function () {
+            var tree = makeTree(6, 7);
+            var chain = makeChain(100000, "d");
+            for (var i = 0; i < 5; i++) {
+                makeTree(4, 8);
+                makeChain(20000, "garbage");
+                collect();
+                assert.areEqual(117649, countLeaves(tree));
+                verifyChain(chain, 100000, "d");
+            }
+        }
+    },
+    {
+        name: "Large arrays of objects",
+        body: function () {
+            var arrays = [];
+            for (var i = 0; i < 8; i++) {
+                var array = [];
+                for (var j = 0; j < 20000 * (i + 1); j++) {
+                    array.push({ i: i, j: j, s: "s" + j });
+                }
+                arrays.push(array);
+            }
+            collect();
+            for (var i = 0; i < arrays.length; i++) {
+                assert.areEqual(20000 * (i + 1), arrays[i].length);
+                for (var j = 0; j < arrays[i].length; j += 997) {
+                    assert.areEqual(i, arrays[i][j].i);
+                    assert.areEqual("s" + j, arrays[i][j].s);
+                }
+            }
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,98 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Fills the recycler's page segments, frees them and fills them again, with small and large objects. This
+// test runs with flags that change how segments are reserved and how their freed pages are handed back.
+
+if (this.WScript && this.WScript.LoadScriptFile) { // Check for running in ch
+    this.WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+}
+
+function collect() {
+    if (typeof CollectGarbage === "function") {
+        CollectGarbage();
+    }
+}
+
+function makeObjects(count, tag) {
+    var objects = [];
+    for (var i = 0; i < count; i++) {
+        objects.push({ i: i, tag: tag, s: tag + i });
+    }
+    return objects;
+}
+
+function verifyObjects(objects, count, tag) {
+    assert.areEqual(count, objects.length);
+    for (var i = 0; i < objects.length; i++) {
+        assert.areEqual(i, objects[i].i);
+        assert.areEqual(tag, objects[i].tag);
+        assert.areEqual(tag + i, objects[i].s);
+    }
+}
+
+function makeArrays(count, length) {
+    var arrays = [];
+    for (var i = 0; i < count; i++) {
+        var array = new Array(length);
+        for (var j = 0; j < length; j += 3) {
+            array[j] = i + j;
+        }
+        arrays.push(array);
+    }
+    return arrays;
+}
+
+function verifyArrays(arrays, count, length) {
+    assert.areEqual(count, arrays.length);
+    for (var i = 0; i < count; i++) {
+        assert.areEqual(length, arrays[i].length);
+        for (var j = 0; j < length; j += 1000) {
+            assert.areEqual(j % 3 === 0 ? i + j : undefined, arrays[i][j]);
+        }
+    }
+}
+
+var tests = [
+    {
+        name: "Small objects in segments that were freed and refilled",
+        body: function () {
+            var kept = makeObjects(50000, "kept");
+            for (var round = 0; round < 4; round++) {
+                makeObjects(100000, "garbage");
+                collect();
+                var fresh = makeObjects(100000, "fresh" + round);
+                verifyObjects(kept, 50000, "kept");
+                verifyObjects(fresh, 100000, "fresh" + round);
+            }
+        }
+    },
+    {
+        name: "Large objects in pages that were freed and refilled",
+        body: function () {
+            for (var round = 0; round < 4; round++) {
+                makeArrays(8, 100000);
+                collect();
+                var arrays = makeArrays(8, 100000 + round);
+                collect();
+                verifyArrays(arrays, 8, 100000 + round);
+            }
+        }
+    },
+    {
+        name: "Objects larger than a huge page that were freed and refilled",
+        body: function () {
+            for (var round = 0; round < 4; round++) {
+                makeArrays(2, 1024 * 1024);
+                collect();
+                var arrays = makeArrays(2, 1024 * 1024 + round);
+                collect();
+                verifyArrays(arrays, 2, 1024 * 1024 + round);
+            }
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
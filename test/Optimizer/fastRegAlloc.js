@@ -0,0 +1,92 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Runs with -on:FastRegAlloc -FastRegAllocSymCount:1 so that full JIT'ed functions are allocated in the fast mode of linear
+// scan, and with -on:FastRegAlloc -off:fulljit, where simple JIT'ed functions always are: high register pressure across
+// loops, mixed int and float values, try/catch and bailouts out of loops.
+
+function pressure(n) {
+    var a = 1, b = 2, c = 3, d = 4, e = 5, f = 6, g = 7, h = 8, i = 9, j = 10, k = 11, l = 12, m = 13, o = 14, p = 15, q = 16;
+    for (var x = 0; x < n; x++) {
+        a = (a + b) & 0xffff; b = (b ^ c) + 1; c = (c + d) & 0xfff; d = (d * 3 + e) & 0xffff;
+        e = (e + f) & 0xff; f = (f ^ g) + x; g = (g + h) & 0xffff; h = (h + i * 2) & 0xfff;
+        i = (i + j) & 0xffff; j = (j ^ k) + 3; k = (k + l) & 0xfff; l = (l * 5 + m) & 0xffff;
+        m = (m + o) & 0xff; o = (o ^ p) + x; p = (p + q) & 0xffff; q = (q + a) & 0xfff;
+    }
+    return [a, b, c, d, e, f, g, h, i, j, k, l, m, o, p, q].join();
+}
+
+function mixed(n) {
+    var sum = 0, fsum = 0.5, product = 1.25, count = 0;
+    for (var x = 0; x < n; x++) {
+        sum += x * 3;
+        fsum += x / 4;
+        product = (product * 1.0001) % 1000;
+        if (x % 7 === 0) {
+            count++;
+        }
+    }
+    return sum + "," + fsum + "," + product.toFixed(6) + "," + count;
+}
+
+function withTry(n) {
+    var total = 0, caught = 0;
+    for (var x = 0; x < n; x++) {
+        var t = x * 2;
+        try {
+            if (x % 10 === 9) {
+                throw t;
+            }
+            total += t;
+        } catch (err) {
+            caught += err;
+        } finally {
+            total += 1;
+        }
+    }
+    return total + "," + caught;
+}
+
+function bailout(values) {
+    var sum = 0, last = 0;
+    for (var x = 0; x < values.length; x++) {
+        var v = values[x];
+        last = v;
+        sum = sum + v;
+    }
+    return sum + "," + last;
+}
+
+var ints = [];
+for (var x = 0; x < 100; x++) {
+    ints.push(x);
+}
+var changed = ints.slice();
+changed[60] = "s";
+
+var results = [];
+for (var run = 0; run < 3; run++) {
+    results.push(pressure(1000), mixed(1000), withTry(100), bailout(ints), bailout(changed));
+}
+
+var expected = [];
+for (var run = 0; run < 3; run++) {
+    expected.push(
+        "44319,2926,169,43682,59,453226,2441,858,39582,4980,2953,41589,200,861829,24921,777",
+        "1498500,124875.5,1.381457,143",
+        "8920,1080",
+        "4950,99",
+        "1770s616263646566676869707172737475767778798081828384858687888990919293949596979899,99");
+}
+
+var passed = true;
+for (var x = 0; x < results.length; x++) {
+    if (results[x] !== expected[x]) {
+        WScript.Echo("FAILED: " + x + ": " + results[x] + " (expected " + expected[x] + ")");
+        passed = false;
+    }
+}
+
+WScript.Echo(passed ? "PASSED" : "FAILED");
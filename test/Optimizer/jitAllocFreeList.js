@@ -0,0 +1,65 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// JIT'd allocations that are served from a swept heap block's free list must come back
+// zeroed and must not hand out the same object twice.
+// The native free list path is only compiled into release builds, which ignore most switches,
+// so the test also runs with default flags and relies on the churn loop to get the helpers jitted.
+
+function makeObject(i) {
+    return { a: i, b: i + 1, c: undefined };
+}
+
+function makeArray(i) {
+    return [i, i + 1, i + 2];
+}
+
+function makeClosure(i) {
+    return function () { return i; };
+}
+
+var kept = [];
+function churn(count) {
+    for (var i = 0; i < count; i++) {
+        var o = makeObject(i);
+        var a = makeArray(i);
+        var f = makeClosure(i);
+        if ((i & 7) === 0) {
+            kept.push(o, a, f);
+        }
+    }
+}
+
+for (var round = 0; round < 4; round++) {
+    churn(20000);
+    // Sweep so that later allocations come from free lists instead of fresh blocks
+    CollectGarbage();
+}
+
+var fresh = [];
+for (var i = 0; i < 20000; i++) {
+    fresh.push(makeObject(i));
+}
+
+var passed = true;
+for (var i = 0; i < kept.length; i += 3) {
+    var o = kept[i], a = kept[i + 1], f = kept[i + 2];
+    var n = o.a;
+    if (o.b !== n + 1 || o.c !== undefined || "d" in o ||
+        a.length !== 3 || a[0] !== n || a[2] !== n + 2 || f() !== n) {
+        passed = false;
+        WScript.Echo("FAILED at kept index " + i);
+        break;
+    }
+}
+
+for (var i = 0; passed && i < fresh.length; i++) {
+    if (fresh[i].a !== i || fresh[i].b !== i + 1 || Object.keys(fresh[i]).length !== 3) {
+        passed = false;
+        WScript.Echo("FAILED at fresh index " + i);
+    }
+}
+
+WScript.Echo(passed ? "PASSED" : "FAILED");
@@ -0,0 +1,63 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Queues a burst of functions and loop bodies whose interpreter counts keep changing while they wait to be compiled, so
+// the background JIT queue is ranked again and again. Debug builds check after every ranking that none of the waiting
+// work items is ahead of one it should be processed after. Whatever order they are compiled in, the results must match.
+
+function makeFunction(n) {
+    var body = "var s = " + n + ";";
+    for (var k = 0; k < 20; k++) {
+        body += "s = (s * " + (k + 3) + " + a) % " + (1000 + n) + ";";
+    }
+    return new Function("a", body + "return s;");
+}
+
+function reference(n, a) {
+    var s = n;
+    for (var k = 0; k < 20; k++) {
+        s = (s * (k + 3) + a) % (1000 + n);
+    }
+    return s;
+}
+
+function hotLoop(count) {
+    var sum = 0;
+    for (var i = 0; i < count; i++) {
+        sum = (sum + i * 7) % 65521;
+    }
+    return sum;
+}
+
+function referenceLoop(count) {
+    var sum = 0;
+    for (var i = 0; i < count; i++) {
+        sum = (sum + i * 7) % 65521;
+    }
+    return sum;
+}
+
+var functions = [];
+for (var n = 0; n < 150; n++) {
+    functions.push(makeFunction(n));
+}
+
+var failed = false;
+for (var round = 0; round < 30 && !failed; round++) {
+    for (var n = 0; n < functions.length; n++) {
+        // Functions further along are called more often, so they get hotter than the ones queued before them
+        var calls = 1 + (n * round) % 13;
+        for (var c = 0; c < calls; c++) {
+            if (functions[n](c) !== reference(n, c)) {
+                failed = true;
+            }
+        }
+    }
+    if (hotLoop(2000 + round * 100) !== referenceLoop(2000 + round * 100)) {
+        failed = true;
+    }
+}
+
+WScript.Echo(failed ? "fail" : "pass");
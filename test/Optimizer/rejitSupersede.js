@@ -0,0 +1,64 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Closures of one function keep running its old code after another closure bails out and schedules a rejit. When
+// they bail out too, each rejit supersedes the previous one while its full JIT work item is still queued, or while the
+// backend is already compiling it. The abandoned work must not leave any closure with wrong or missing code.
+
+function makeWorker() {
+    return function (kind, x) {
+        var result = 0;
+        for (var i = 0; i < 4; i++) {
+            switch (kind) {
+                case 0: result += x + i; break;
+                case 1: result += x * 2 - i; break;
+                case 2: result += (x ^ i) + 3; break;
+                case 3: result += (x >> 1) + i * i; break;
+                case 4: result += x % 7 + i; break;
+                case 5: result += (x | i) - 1; break;
+                case 6: result += x * i + 6; break;
+                case 7: result += (x & 15) + i * 3; break;
+                case 8: result += x - i * 2 + 8; break;
+                case 9: result += (x << 2) - i; break;
+                case 10: result += x + i + 10; break;
+                case 11: result += (x % 5) * i + 11; break;
+                default: result += 1; break;
+            }
+        }
+        return result;
+    };
+}
+
+function expected(kind, x) {
+    var result = 0;
+    for (var i = 0; i < 4; i++) {
+        result += [x + i, x * 2 - i, (x ^ i) + 3, (x >> 1) + i * i, x % 7 + i, (x | i) - 1, x * i + 6, (x & 15) + i * 3,
+            x - i * 2 + 8, (x << 2) - i, x + i + 10, (x % 5) * i + 11][kind];
+    }
+    return result;
+}
+
+var workers = [];
+for (var i = 0; i < 8; i++) {
+    workers.push(makeWorker());
+}
+
+var passed = true;
+for (var round = 0; round < 12; round++) {
+    for (var w = 0; w < workers.length; w++) {
+        // Each round takes every closure down a case it hasn't run in its jitted code yet.
+        var kind = (round + w) % 12;
+        for (var call = 0; call < 20; call++) {
+            var x = round * 100 + w * 10 + call;
+            var actual = workers[w](kind, x);
+            if (actual !== expected(kind, x)) {
+                WScript.Echo("FAILED: worker " + w + ", kind " + kind + ", x " + x + ": " + actual);
+                passed = false;
+            }
+        }
+    }
+}
+
+WScript.Echo(passed ? "PASSED" : "FAILED");
@@ -0,0 +1,48 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Allocation throughput of JIT'd code creating short-lived object literals, small arrays and
+// closures. Most objects die young, so after the first collections the recycler serves these
+// allocations from swept free lists rather than fresh blocks. Compare with -off:JitAllocFreeList
+// to measure the native free list fast path.
+
+function point(x, y) {
+    return { x: x, y: y };
+}
+
+function segment(i) {
+    return { from: point(i, i + 1), to: point(i + 2, i + 3), tag: [i, i] };
+}
+
+function adder(n) {
+    return function (v) { return v + n; };
+}
+
+function run(iterations) {
+    var sum = 0;
+    var survivors = [];
+    for (var i = 0; i < iterations; i++) {
+        var s = segment(i);
+        var f = adder(i & 15);
+        sum += f(s.to.y - s.from.x) + s.tag.length;
+        if ((i & 1023) === 0) {
+            survivors.push(s);
+        }
+    }
+    return sum + survivors.length;
+}
+
+// Warm up so that the measured loop runs in the full JIT
+run(10000);
+
+var start = new Date();
+var result = run(3000000);
+var elapsed = new Date() - start;
+
+if (result !== 37502930) {
+    throw new Error("ERROR: bad result: " + result);
+}
+
+WScript.Echo("### TIME:", elapsed, "ms");
@@ -0,0 +1,49 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Parsing API payloads: an indented array of records that share a shape, with string fields of various
+// lengths (a few of them escaped), numbers, booleans and nested objects. Exercises the JSON scanner's
+// string and whitespace handling and object creation in JSON.parse.
+
+function makePayload(count) {
+    var items = [];
+    for (var i = 0; i < count; i++) {
+        items.push({
+            id: i,
+            name: "item " + i,
+            description: "A reasonably long description of item number " + i + ", as found in product listings",
+            path: (i % 10) === 0 ? "C:\\data\\" + i : "/data/" + i,
+            price: i / 4,
+            active: (i & 1) === 0,
+            owner: { id: i % 17, login: "user" + (i % 17) }
+        });
+    }
+    return JSON.stringify({ page: 1, total: count, items: items }, null, 2);
+}
+
+var payload = makePayload(500);
+
+function run(iterations) {
+    var sum = 0;
+    for (var i = 0; i < iterations; i++) {
+        var parsed = JSON.parse(payload);
+        var items = parsed.items;
+        sum += items.length + items[i % items.length].description.length + items[(i * 7) % items.length].owner.id;
+    }
+    return sum;
+}
+
+// Warm up
+run(10);
+
+var start = new Date();
+var result = run(500);
+var elapsed = new Date() - start;
+
+if (result !== 292855) {
+    throw new Error("ERROR: bad result: " + result);
+}
+
+WScript.Echo("### TIME:", elapsed, "ms");
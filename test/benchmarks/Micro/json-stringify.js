@@ -0,0 +1,48 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Serializing API responses: arrays of records that share a shape, with nested objects, number arrays
+// and short strings, stringified without a replacer or indentation. Exercises the JSON.stringify path
+// for plain data objects and arrays.
+
+function makeResponse(count) {
+    var items = [];
+    for (var i = 0; i < count; i++) {
+        items.push({
+            id: i,
+            name: "item " + i,
+            price: i / 4,
+            active: (i & 1) === 0,
+            tags: ["a", "b" + (i % 5)],
+            owner: { id: i % 17, login: "user" + (i % 17), score: [i & 7, i % 3, 1.5] },
+            note: (i % 9) === 0 ? "line\nbreak" : null
+        });
+    }
+    return { page: 1, total: count, items: items };
+}
+
+var response = makeResponse(200);
+
+function run(iterations) {
+    var length = 0;
+    for (var i = 0; i < iterations; i++) {
+        response.page = i;
+        length += JSON.stringify(response).length;
+    }
+    return length;
+}
+
+// Warm up
+run(20);
+
+var start = new Date();
+var result = run(2000);
+var elapsed = new Date() - start;
+
+if (result !== 55282890) {
+    throw new Error("ERROR: bad result: " + result);
+}
+
+WScript.Echo("### TIME:", elapsed, "ms");
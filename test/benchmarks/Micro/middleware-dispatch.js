@@ -0,0 +1,111 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Middleware-style dispatch as found in web frameworks and event emitters: handlers bound to their
+// owners, forwarded through Function.prototype.apply and call, and request objects of several shapes
+// read through getters at the same call sites. Measures how well the JIT inlines calls through bound
+// functions, nested apply/call and polymorphic accessors.
+
+function Request(id, path) {
+    this._id = id;
+    this._path = path;
+}
+Object.defineProperty(Request.prototype, "id", { get: function () { return this._id; } });
+Object.defineProperty(Request.prototype, "path", { get: function () { return this._path; } });
+
+function AuthedRequest(id, path, user) {
+    this._id = id;
+    this._path = path;
+    this._user = user;
+}
+Object.defineProperty(AuthedRequest.prototype, "id", { get: function () { return this._id + 1; } });
+Object.defineProperty(AuthedRequest.prototype, "path", { get: function () { return "/auth" + this._path; } });
+
+var plainRequest = {
+    get id() { return 7; },
+    get path() { return "/plain"; }
+};
+
+function Logger() {
+    this.count = 0;
+}
+Logger.prototype.handle = function (req, res) {
+    this.count += req.id & 3;
+    res.log++;
+};
+
+function Router(prefixLength) {
+    this.prefixLength = prefixLength;
+}
+Router.prototype.handle = function (req, res) {
+    res.matched += req.path.length > this.prefixLength ? 1 : 0;
+};
+
+function Counter() {
+    this.total = 0;
+}
+Counter.prototype.handle = function (req, res) {
+    this.total += req.id;
+    res.status = 200;
+};
+
+// Forwards to the next handler the way wrappers in middleware chains usually do.
+function wrap(handler) {
+    return function () {
+        return handler.apply(this, arguments);
+    };
+}
+
+function forward(handler) {
+    return function (req, res) {
+        return handler.call(this, req, res);
+    };
+}
+
+var logger = new Logger();
+var router = new Router(6);
+var counter = new Counter();
+
+var chain = [
+    logger.handle.bind(logger),
+    wrap(router.handle.bind(router)),
+    forward(wrap(counter.handle.bind(counter)))
+];
+
+function dispatch(req, res) {
+    for (var i = 0; i < chain.length; i++) {
+        chain[i](req, res);
+    }
+}
+
+var requests = [];
+for (var i = 0; i < 64; i++) {
+    switch (i % 3) {
+        case 0: requests.push(new Request(i, "/items/" + i)); break;
+        case 1: requests.push(new AuthedRequest(i, "/" + i, "user" + i)); break;
+        default: requests.push(plainRequest); break;
+    }
+}
+
+function run(iterations) {
+    var res = { log: 0, matched: 0, status: 0 };
+    for (var i = 0; i < iterations; i++) {
+        dispatch(requests[i & 63], res);
+    }
+    return res.log + res.matched + res.status + logger.count + counter.total;
+}
+
+// Warm up
+run(1000);
+
+var start = new Date();
+var result = run(2000000);
+var elapsed = new Date() - start;
+
+if (result !== 54619254) {
+    throw new Error("ERROR: bad result: " + result);
+}
+
+WScript.Echo("### TIME:", elapsed, "ms");
@@ -0,0 +1,69 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Numeric typed arrays sorted without a comparer, as in analytics code computing medians and
+// percentiles. Covers 8, 16 and 32-bit integers and 32 and 64-bit floats, from 10^3 to 10^7 elements;
+// the total number of elements sorted is about the same for every size.
+
+var seed = 1;
+function random() {
+    // Park-Miller generator, so every run sorts the same data
+    seed = (seed * 16807) % 2147483647;
+    return seed;
+}
+
+function fill(array) {
+    var isFloat = array instanceof Float32Array || array instanceof Float64Array;
+    for (var i = 0; i < array.length; i++) {
+        var value = random();
+        array[i] = isFloat ? (value - 1073741824) / 65536 : value;
+    }
+}
+
+function checksum(array) {
+    // Sum of the values at a few fixed positions, which depends on the array being sorted
+    var sum = 0;
+    for (var i = 0; i < 8; i++) {
+        sum += Math.floor(array[Math.floor(array.length * i / 8)]);
+    }
+    return sum;
+}
+
+var types = [Int8Array, Uint16Array, Int32Array, Float32Array, Float64Array];
+var sizes = [1000, 100000, 10000000];
+var maxSize = sizes[sizes.length - 1];
+
+// The unsorted data is generated up front, so the timed loop only copies and sorts
+var sources = types.map(function (TypedArray) {
+    var source = new TypedArray(maxSize);
+    fill(source);
+    return source;
+});
+
+function run() {
+    var result = 0;
+    for (var t = 0; t < types.length; t++) {
+        for (var s = 0; s < sizes.length; s++) {
+            var array = new types[t](sizes[s]);
+            var iterations = maxSize / sizes[s];
+            for (var i = 0; i < iterations; i++) {
+                array.set(sources[t].subarray(i * sizes[s], (i + 1) * sizes[s]));
+                array.sort();
+                result += checksum(array);
+            }
+        }
+    }
+    return result;
+}
+
+var start = new Date();
+var result = run();
+var elapsed = new Date() - start;
+
+if (result !== 76020389198068) {
+    throw new Error("ERROR: bad result: " + result);
+}
+
+WScript.Echo("### TIME:", elapsed, "ms");
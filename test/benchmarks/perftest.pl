@@ -577,6 +577,7 @@ sub usage
     print "  -kraken                Run the kraken benchmark\n";
     print "  -octane                Run the Octane 2.0 benchmark\n";
     print "  -jetstream             Run the JetStream benchmark (only non octane and sunspider tests)\n";
+    print "  -micro                 Run the engine micro-benchmarks in Micro\n";
     print "  -file:<file>           Run the specified js file\n";
     print "  -args:<other args>     Other arguments to ch.exe\n";
     print "  -score                 Test output scores\n";
@@ -686,6 +687,14 @@ sub parse_args
             $basefile = "perfbase$dir.txt";
             $is_dynamicProfileRun = 0; # Currently  dyna-pogo info is not avialable in the browser - remove this when it is.
         }
+        elsif($ARGV[$i] =~ /[-\/]micro/i)
+        {
+            @testlist = ("alloc-object-literals", "typedarray-sort", "json-stringify", "json-parse", "middleware-dispatch");
+            $testDescription = "engine micro-benchmarks";
+            $dir = "Micro";
+            $basefile = "perfbase$dir.txt";
+            $is_dynamicProfileRun = 0;
+        }
         elsif($ARGV[$i] =~ /[-\/]kraken/i)
         {
             if($iter == $defaultIter)
@@ -1379,6 +1379,33 @@ var tests = [
             f[4] = 99.9999;
             assert.areEqual([99.9999,99.9999,99.99999,99.999999999999,100], f.sort(), "%TypedArrayPrototype%.sort basic behavior with 64-bit floats");
 
+            var floats = new Float64Array([NaN, 1, -0, -Infinity, 0, -NaN, Infinity, -1]).sort();
+            assert.areEqual([-Infinity, -1, -0, 0, 1, Infinity], Array.prototype.slice.call(floats, 0, 6), "%TypedArrayPrototype%.sort orders 64-bit floats numerically");
+            assert.isTrue(1 / floats[2] === -Infinity && 1 / floats[3] === Infinity, "%TypedArrayPrototype%.sort orders -0 before +0");
+            assert.isTrue(isNaN(floats[6]) && isNaN(floats[7]), "%TypedArrayPrototype%.sort puts NaN last");
+
+            // Longer arrays are sorted by value rather than by comparing elements
+            [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array, Int32Array, Uint32Array, Float32Array, Float64Array].forEach(function (TypedArrayCtor) {
+                var length = 1000;
+                var t = new TypedArrayCtor(length);
+                for (var i = 0; i < length; i++) {
+                    t[i] = ((i * 7919) % 601) - 300;
+                }
+                if (TypedArrayCtor === Float32Array || TypedArrayCtor === Float64Array) {
+                    t[10] = NaN;
+                    t[20] = -0;
+                    t[30] = Infinity;
+                    t[40] = -Infinity;
+                }
+
+                var expected = Array.prototype.slice.call(t).sort(function (x, y) {
+                    if (isNaN(x)) { return isNaN(y) ? 0 : 1; }
+                    if (isNaN(y)) { return -1; }
+                    return x === y ? (1 / x) - (1 / y) : x - y;
+                });
+                assert.areEqual(expected, Array.prototype.slice.call(t.sort()), "%TypedArrayPrototype%.sort sorts a " + TypedArrayCtor.name + " of " + length + " elements");
+            });
+
             function sortCallbackReverse(x, y) {
                 if (x < y) {
                     return 1;
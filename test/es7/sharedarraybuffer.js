@@ -160,6 +160,35 @@ var tests = [{
             });
 		}
 	},
+    {
+        name: "%TypedArrayPrototype%.sort on a SharedArrayBuffer",
+        body: function() {
+            typedArrayList.forEach(function(TypedArrayCtor) {
+                // Short arrays are insertion sorted, longer ones radix sorted; each view leaves one element on either side
+                [10, 1000].forEach(function(length) {
+                    var sab = new SharedArrayBuffer((length + 2) * TypedArrayCtor.BYTES_PER_ELEMENT);
+                    var whole = new TypedArrayCtor(sab);
+                    whole[0] = 7;
+                    whole[length + 1] = 9;
+
+                    var view = new TypedArrayCtor(sab, TypedArrayCtor.BYTES_PER_ELEMENT, length);
+                    var expected = [];
+                    for (var i = 0; i < length; i++) {
+                        view[i] = ((i * 7919) % 101) - 50;
+                        expected.push(view[i]);
+                    }
+                    expected.sort(function(a, b) { return a - b; });
+
+                    assert.areEqual(view, view.sort(), TypedArrayCtor.name + " sort returns the array");
+                    for (var i = 0; i < length; i++) {
+                        assert.areEqual(expected[i], view[i], TypedArrayCtor.name + " of length " + length + " is sorted at index " + i);
+                    }
+                    assert.areEqual(7, whole[0], TypedArrayCtor.name + " element before the view is untouched");
+                    assert.areEqual(9, whole[length + 1], TypedArrayCtor.name + " element after the view is untouched");
+                });
+            });
+        }
+    },
 ];
 
 testRunner.runTests(tests, {
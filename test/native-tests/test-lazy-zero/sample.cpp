@@ -0,0 +1,87 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#include "ChakraCore.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string>
+#include <cstring>
+
+#define FAIL_CHECK(cmd)                     \
+    do                                      \
+    {                                       \
+        JsErrorCode errCode = cmd;          \
+        if (errCode != JsNoError)           \
+        {                                   \
+            printf("Error %d at '%s'\n",    \
+                errCode, #cmd);             \
+            return 1;                       \
+        }                                   \
+    } while(0)
+
+using namespace std;
+
+int main()
+{
+    JsRuntimeHandle runtime;
+    JsContextRef context;
+    JsValueRef result;
+    unsigned currentSourceContext = 0;
+
+    // Each array's segment is a large object of about 24 pages, above the default
+    // -LazyZeroPageThreshold of 16, so freeing it goes through the lazy zeroing path
+    const char* script =
+        "(()=>{"
+        "  var keep = [];"
+        "  for (var i = 0; i < 64; i++) {"
+        "    var a = new Array(12000);"
+        "    for (var j = 0; j < a.length; j++) { a[j] = j + 0.5; }"
+        "    keep.push(a);"
+        "  }"
+        "  return keep.length;"
+        "})()";
+
+    // Create a runtime.
+    FAIL_CHECK(JsCreateRuntime(JsRuntimeAttributeNone, nullptr, &runtime));
+
+    // Create an execution context.
+    FAIL_CHECK(JsCreateContext(runtime, &context));
+
+    // Now set the current execution context.
+    FAIL_CHECK(JsSetCurrentContext(context));
+
+    JsValueRef fname;
+    FAIL_CHECK(JsCreateStringUtf8((const uint8_t*)"sample", strlen("sample"), &fname));
+
+    JsValueRef scriptSource;
+    FAIL_CHECK(JsCreateExternalArrayBuffer((void*)script, (unsigned int)strlen(script),
+        nullptr, nullptr, &scriptSource));
+
+    // Allocate the large arrays, drop them, and collect, a few times over so that
+    // the freed pages are returned to the page allocator
+    for (int i = 0; i < 4; i++)
+    {
+        FAIL_CHECK(JsRun(scriptSource, currentSourceContext++, fname, JsParseScriptAttributeNone, &result));
+        FAIL_CHECK(JsCollectGarbage(runtime));
+    }
+
+    size_t lazyZeroedMemory = 0;
+    FAIL_CHECK(JsGetRuntimeLazyZeroedMemory(runtime, &lazyZeroedMemory));
+
+    if (lazyZeroedMemory > 0)
+    {
+        printf("Result -> SUCCESS \n");
+    }
+    else
+    {
+        printf("Result -> no freed memory was zeroed lazily \n");
+    }
+
+    // Dispose runtime
+    FAIL_CHECK(JsSetCurrentContext(JS_INVALID_REFERENCE));
+    FAIL_CHECK(JsDisposeRuntime(runtime));
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#include "ChakraCore.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string>
+#include <cstring>
+
+#define FAIL_CHECK(cmd)                     \
+    do                                      \
+    {                                       \
+        JsErrorCode errCode = cmd;          \
+        if (errCode != JsNoError)           \
+        {                                   \
+            printf("Error %d at '%s'\n",    \
+                errCode, #cmd);             \
+            return 1;                       \
+        }                                   \
+    } while(0)
+
+using namespace std;
+
+int main()
+{
+    JsRuntimeHandle runtime;
+    JsValueRef result;
+    const JsSourceContext sourceContext = 1;
+
+    const char* script =
+        "(()=>{"
+        "  function add(a, b) { return a + b; }"
+        "  var sum = 0;"
+        "  for (var i = 0; i < 1000; i++) { sum = add(sum, i); }"
+        "  return sum;"
+        "})()";
+
+    // Create a runtime that can save and load profiles.
+    FAIL_CHECK(JsCreateRuntime(JsRuntimeAttributeEnableProfilePersistence, nullptr, &runtime));
+
+    // Stands in for the host's profile store between runs
+    char* savedProfile = nullptr;
+    unsigned int savedProfileLength = 0;
+
+    // Every run but the first loads the profile the previous run saved, so both
+    // saving and loading have to keep working after the first time in a process
+    for (int run = 0; run < 3; run++)
+    {
+        JsContextRef context;
+        FAIL_CHECK(JsCreateContext(runtime, &context));
+        FAIL_CHECK(JsSetCurrentContext(context));
+
+        if (savedProfile != nullptr)
+        {
+            JsValueRef profile;
+            BYTE* profileStorage;
+            unsigned int profileLength;
+            FAIL_CHECK(JsCreateArrayBuffer(savedProfileLength, &profile));
+            FAIL_CHECK(JsGetArrayBufferStorage(profile, &profileStorage, &profileLength));
+            memcpy(profileStorage, savedProfile, savedProfileLength);
+            FAIL_CHECK(JsLoadScriptProfile(sourceContext, profile));
+        }
+
+        JsValueRef fname;
+        FAIL_CHECK(JsCreateStringUtf8((const uint8_t*)"sample", strlen("sample"), &fname));
+
+        JsValueRef scriptSource;
+        FAIL_CHECK(JsCreateExternalArrayBuffer((void*)script, (unsigned int)strlen(script),
+            nullptr, nullptr, &scriptSource));
+        FAIL_CHECK(JsRun(scriptSource, sourceContext, fname, JsParseScriptAttributeNone, &result));
+
+        JsValueRef profile;
+        BYTE* profileStorage;
+        unsigned int profileLength;
+        FAIL_CHECK(JsSerializeScriptProfile(sourceContext, &profile));
+        FAIL_CHECK(JsGetArrayBufferStorage(profile, &profileStorage, &profileLength));
+        if (profileLength == 0)
+        {
+            printf("Result -> run %d saved an empty profile \n", run);
+            return 1;
+        }
+
+        free(savedProfile);
+        savedProfile = (char*)malloc(profileLength);
+        memcpy(savedProfile, profileStorage, profileLength);
+        savedProfileLength = profileLength;
+
+        FAIL_CHECK(JsSetCurrentContext(JS_INVALID_REFERENCE));
+    }
+
+    free(savedProfile);
+    printf("Result -> SUCCESS \n");
+
+    // Dispose runtime
+    FAIL_CHECK(JsDisposeRuntime(runtime));
+
+    return 0;
+}
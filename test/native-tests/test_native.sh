@@ -71,4 +71,10 @@ RUN "test-char16"
 # test-static-native
 RUN "test-static-native"
 
+# test-lazy-zero
+RUN "test-lazy-zero"
+
+# test-profile-roundtrip
+RUN "test-profile-roundtrip"
+
 SAFE_RUN `rm -rf Makefile`